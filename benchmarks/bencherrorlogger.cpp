@@ -0,0 +1,74 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.h"
+#include "errorlogger.h"
+#include "errortypes.h"
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <utility>
+
+namespace {
+    ErrorMessage createErrorMessage()
+    {
+        std::list<ErrorMessage::FileLocation> callStack;
+        callStack.emplace_back("src/core/buffer.cpp", "Assignment 'p=nullptr', assigned value is 0", 120, 9);
+        callStack.emplace_back("src/core/buffer.cpp", "Null pointer dereference", 134, 5);
+        callStack.emplace_back("include/core/buffer.h", 42, 17);
+        ErrorMessage msg(std::move(callStack),
+                         "src/core/buffer.cpp",
+                         Severity::error,
+                         "Null pointer dereference: p\n"
+                         "Null pointer dereference: p. The pointer 'p' is assigned a null pointer value and dereferenced afterwards.",
+                         "nullPointer",
+                         CWE(476U),
+                         Certainty::normal);
+        msg.hash = 1234567890;
+        msg.remark = "reviewed";
+        return msg;
+    }
+}
+
+static void BM_ErrorMessage_serialize(benchmark::State& state)
+{
+    const ErrorMessage msg = createErrorMessage();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(msg.serialize());
+}
+BENCHMARK(BM_ErrorMessage_serialize);
+
+static void BM_ErrorMessage_deserialize(benchmark::State& state)
+{
+    const std::string data = createErrorMessage().serialize();
+    for (auto _ : state) {
+        ErrorMessage msg;
+        msg.deserialize(data);
+        benchmark::DoNotOptimize(msg);
+    }
+}
+BENCHMARK(BM_ErrorMessage_deserialize);
+
+static void BM_ErrorMessage_toXML(benchmark::State& state)
+{
+    const ErrorMessage msg = createErrorMessage();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(msg.toXML());
+}
+BENCHMARK(BM_ErrorMessage_toXML);
@@ -0,0 +1,212 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <regex>
+
+namespace {
+    std::vector<std::unique_ptr<benchmark::Benchmark>>& registry()
+    {
+        static std::vector<std::unique_ptr<benchmark::Benchmark>> benchmarks;
+        return benchmarks;
+    }
+
+    std::int64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    struct Options {
+        std::string filter;
+        double minTime = 0.5;
+        int repetitions = 1;
+        bool json{};
+        bool list{};
+    };
+
+    struct Result {
+        std::string name;
+        std::uint64_t iterations;
+        double nsPerIteration;
+        double itemsPerSecond;
+    };
+
+    Result run(const std::string& name, benchmark::Function function, const std::vector<std::int64_t>& args, std::uint64_t iterations)
+    {
+        benchmark::State state(iterations, args);
+        function(state);
+        const double elapsed = static_cast<double>(std::max<std::int64_t>(state.elapsed(), 1));
+        Result result;
+        result.name = name;
+        result.iterations = iterations;
+        result.nsPerIteration = elapsed / static_cast<double>(iterations);
+        result.itemsPerSecond = static_cast<double>(state.itemsProcessed()) * 1e9 / elapsed;
+        return result;
+    }
+
+    /** find the number of iterations which takes at least the minimum time */
+    std::uint64_t findIterations(benchmark::Function function, const std::vector<std::int64_t>& args, double minTime)
+    {
+        std::uint64_t iterations = 1;
+        for (;;) {
+            benchmark::State state(iterations, args);
+            function(state);
+            const double seconds = static_cast<double>(state.elapsed()) / 1e9;
+            if (seconds >= minTime || iterations >= 1000000000)
+                return iterations;
+            // predict the required iterations with some headroom but do not grow too fast since the first runs are noisy
+            const double multiplier = seconds > 0 ? std::min(minTime * 1.4 / seconds, 10.0) : 10.0;
+            iterations = std::max(iterations + 1, static_cast<std::uint64_t>(static_cast<double>(iterations) * multiplier));
+        }
+    }
+
+    bool parseOptions(int argc, const char* const argv[], Options& options)
+    {
+        for (int i = 1; i < argc; ++i) {
+            const char* const arg = argv[i];
+            if (std::strncmp(arg, "--benchmark_filter=", 19) == 0)
+                options.filter = arg + 19;
+            else if (std::strncmp(arg, "--benchmark_min_time=", 21) == 0)
+                options.minTime = std::strtod(arg + 21, nullptr);
+            else if (std::strncmp(arg, "--benchmark_repetitions=", 24) == 0)
+                options.repetitions = std::max(1, std::atoi(arg + 24));
+            else if (std::strcmp(arg, "--benchmark_format=json") == 0)
+                options.json = true;
+            else if (std::strcmp(arg, "--benchmark_format=console") == 0)
+                options.json = false;
+            else if (std::strcmp(arg, "--benchmark_list_tests") == 0)
+                options.list = true;
+            else {
+                std::cerr << "unknown option: " << arg << std::endl;
+                std::cerr << "usage: " << argv[0] << " [--benchmark_filter=<regex>] [--benchmark_min_time=<seconds>]"
+                          << " [--benchmark_repetitions=<n>] [--benchmark_format=console|json] [--benchmark_list_tests]" << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void printConsole(const Result& result)
+    {
+        std::cout << std::left << std::setw(48) << result.name << std::right
+                  << std::setw(14) << std::fixed << std::setprecision(1) << result.nsPerIteration << " ns"
+                  << std::setw(14) << result.iterations;
+        if (result.itemsPerSecond > 0)
+            std::cout << std::setw(14) << std::setprecision(3) << result.itemsPerSecond / 1e6 << " M items/s";
+        std::cout << std::endl;
+    }
+
+    void printJson(const std::vector<Result>& results)
+    {
+        std::cout << "{\n  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const Result& result = results[i];
+            std::cout << (i > 0 ? "," : "") << "\n    {"
+                      << "\"name\": \"" << result.name << "\", "
+                      << "\"iterations\": " << result.iterations << ", "
+                      << "\"real_time\": " << std::fixed << std::setprecision(3) << result.nsPerIteration << ", "
+                      << "\"time_unit\": \"ns\"";
+            if (result.itemsPerSecond > 0)
+                std::cout << ", \"items_per_second\": " << result.itemsPerSecond;
+            std::cout << "}";
+        }
+        std::cout << "\n  ]\n}" << std::endl;
+    }
+}
+
+benchmark::State::Iterator benchmark::State::begin()
+{
+    mStart = now();
+    return {this, mIterations};
+}
+
+void benchmark::State::stopTiming()
+{
+    mElapsed = now() - mStart;
+}
+
+benchmark::Benchmark::Benchmark(std::string name, Function function)
+    : mName(std::move(name))
+    , mFunction(function)
+{}
+
+benchmark::Benchmark* benchmark::RegisterBenchmark(const char name[], Function function)
+{
+    registry().emplace_back(new Benchmark(name, function));
+    return registry().back().get();
+}
+
+int benchmark::RunSpecifiedBenchmarks(int argc, const char* const argv[])
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+        return EXIT_FAILURE;
+
+    std::regex filter;
+    try {
+        filter = std::regex(options.filter.empty() ? "." : options.filter);
+    } catch (const std::regex_error& e) {
+        std::cerr << "invalid filter '" << options.filter << "': " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // a benchmark without arguments is run once without arguments
+    std::vector<std::pair<std::string, std::pair<Function, std::vector<std::int64_t>>>> instances;
+    for (const auto& b : registry()) {
+        if (b->args().empty())
+            instances.emplace_back(b->name(), std::make_pair(b->function(), std::vector<std::int64_t>{}));
+        for (const std::int64_t arg : b->args())
+            instances.emplace_back(b->name() + "/" + std::to_string(arg), std::make_pair(b->function(), std::vector<std::int64_t>{arg}));
+    }
+
+    if (!options.json && !options.list) {
+        std::cout << std::left << std::setw(48) << "Benchmark" << std::right
+                  << std::setw(17) << "Time" << std::setw(14) << "Iterations" << std::endl;
+    }
+
+    std::vector<Result> results;
+    for (const auto& instance : instances) {
+        const std::string& name = instance.first;
+        if (!std::regex_search(name, filter))
+            continue;
+        if (options.list) {
+            std::cout << name << std::endl;
+            continue;
+        }
+        const Function function = instance.second.first;
+        const std::vector<std::int64_t>& args = instance.second.second;
+        const std::uint64_t iterations = findIterations(function, args, options.minTime);
+        for (int i = 0; i < options.repetitions; ++i) {
+            results.push_back(run(name, function, args, iterations));
+            if (!options.json)
+                printConsole(results.back());
+        }
+    }
+
+    if (options.json)
+        printJson(results);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,165 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef benchmarkH
+#define benchmarkH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Minimal micro-benchmark harness with a subset of the Google Benchmark API.
+ *
+ * A benchmark is a function which runs the measured code in a range-based for
+ * loop over the given State. It is registered with BENCHMARK() and can be
+ * parameterized with Arg():
+ *
+ * @code
+ * static void BM_example(benchmark::State& state) {
+ *     const std::string input(state.range(0), 'x');
+ *     for (auto _ : state)
+ *         benchmark::DoNotOptimize(input.find('y'));
+ * }
+ * BENCHMARK(BM_example)->Arg(8)->Arg(512);
+ * @endcode
+ */
+namespace benchmark {
+    class State {
+    public:
+        State(std::uint64_t iterations, std::vector<std::int64_t> args)
+            : mIterations(iterations), mArgs(std::move(args)) {}
+
+        class Iterator {
+        public:
+            Iterator(State* state, std::uint64_t remaining) : mState(state), mRemaining(remaining) {}
+            // the value is not used - it only exists to be compatible with "for (auto _ : state)"
+            struct UNUSED Value {};
+            Value operator*() const {
+                return {};
+            }
+            Iterator& operator++() {
+                --mRemaining;
+                return *this;
+            }
+            bool operator!=(const Iterator& /*end*/) {
+                if (mRemaining != 0)
+                    return true;
+                mState->stopTiming();
+                return false;
+            }
+        private:
+            State* mState;
+            std::uint64_t mRemaining;
+        };
+
+        /** starts the timing - it is stopped when the loop finishes */
+        Iterator begin();
+        Iterator end() {
+            return {this, 0};
+        }
+
+        std::int64_t range(std::size_t i = 0) const {
+            return mArgs.at(i);
+        }
+
+        std::uint64_t iterations() const {
+            return mIterations;
+        }
+
+        /** the number of items which were processed in total - used to show a throughput */
+        void SetItemsProcessed(std::int64_t items) {
+            mItemsProcessed = items;
+        }
+        std::int64_t itemsProcessed() const {
+            return mItemsProcessed;
+        }
+
+        /** the measured time of the loop in nanoseconds */
+        std::int64_t elapsed() const {
+            return mElapsed;
+        }
+
+    private:
+        void stopTiming();
+
+        const std::uint64_t mIterations;
+        const std::vector<std::int64_t> mArgs;
+        std::int64_t mItemsProcessed{};
+        std::int64_t mStart{};
+        std::int64_t mElapsed{};
+    };
+
+    using Function = void (*)(State&);
+
+    class Benchmark {
+    public:
+        Benchmark(std::string name, Function function);
+
+        Benchmark* Arg(std::int64_t arg) {
+            mArgs.push_back(arg);
+            return this;
+        }
+
+        const std::string& name() const {
+            return mName;
+        }
+        Function function() const {
+            return mFunction;
+        }
+        const std::vector<std::int64_t>& args() const {
+            return mArgs;
+        }
+
+    private:
+        const std::string mName;
+        const Function mFunction;
+        std::vector<std::int64_t> mArgs;
+    };
+
+    Benchmark* RegisterBenchmark(const char name[], Function function);
+
+    /** prevent the compiler from optimizing away the computation of the given value */
+    template<class T>
+    inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__)
+        asm volatile ("" : : "r,m" (value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    /** run the registered benchmarks which match the command-line */
+    int RunSpecifiedBenchmarks(int argc, const char* const argv[]);
+}
+
+#define BENCHMARK_CONCAT2(a, b) a ## b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT2(a, b)
+
+#define BENCHMARK(function) \
+    static benchmark::Benchmark* BENCHMARK_CONCAT(benchmark_, __LINE__) = benchmark::RegisterBenchmark(#function, function)
+
+//---------------------------------------------------------------------------
+#endif // benchmarkH
@@ -0,0 +1,74 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.h"
+#include "mathlib.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::vector<std::string> decimals{"0", "1", "42", "-42", "123456789", "2147483647", "-2147483648", "9223372036854775807"};
+    const std::vector<std::string> suffixes{"0U", "1L", "42u", "123ul", "123456789LL", "2147483647ULL", "1i64", "7z"};
+    const std::vector<std::string> radixes{"0x0", "0x7fffffff", "0XDEADBEEF", "0777", "0b1010", "0B11110000", "0x00ff", "01234567"};
+    const std::vector<std::string> characters{"'a'", "'\\0'", "'\\n'", "'\\x41'", "'\\101'", "L'a'", "u'b'", "U'c'"};
+
+    void toBigNumber(benchmark::State& state, const std::vector<std::string>& numbers)
+    {
+        for (auto _ : state) {
+            for (const std::string& number : numbers)
+                benchmark::DoNotOptimize(MathLib::toBigNumber(number));
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * numbers.size()));
+    }
+}
+
+static void BM_MathLib_toBigNumber_decimal(benchmark::State& state)
+{
+    toBigNumber(state, decimals);
+}
+BENCHMARK(BM_MathLib_toBigNumber_decimal);
+
+static void BM_MathLib_toBigNumber_suffix(benchmark::State& state)
+{
+    toBigNumber(state, suffixes);
+}
+BENCHMARK(BM_MathLib_toBigNumber_suffix);
+
+static void BM_MathLib_toBigNumber_radix(benchmark::State& state)
+{
+    toBigNumber(state, radixes);
+}
+BENCHMARK(BM_MathLib_toBigNumber_radix);
+
+static void BM_MathLib_toBigNumber_char(benchmark::State& state)
+{
+    toBigNumber(state, characters);
+}
+BENCHMARK(BM_MathLib_toBigNumber_char);
+
+static void BM_MathLib_isInt(benchmark::State& state)
+{
+    for (auto _ : state) {
+        for (const std::string& number : radixes)
+            benchmark::DoNotOptimize(MathLib::isInt(number));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * radixes.size()));
+}
+BENCHMARK(BM_MathLib_isInt);
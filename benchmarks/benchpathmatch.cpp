@@ -0,0 +1,90 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.h"
+#include "pathmatch.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::vector<std::string> patterns{
+        "externals/",
+        "build/",
+        "*.pb.cc",
+        "src/generated/**",
+        "test/**/fixture?.cpp",
+        "/usr/include/",
+        "third_party/*/include/",
+        "lib/legacy/old.c",
+    };
+
+    const std::vector<std::string> paths{
+        "/home/user/project/src/main.cpp",
+        "/home/user/project/src/core/token.cpp",
+        "/home/user/project/src/generated/parser/grammar.cpp",
+        "/home/user/project/externals/zlib/inflate.c",
+        "/home/user/project/test/unit/fixture1.cpp",
+        "/home/user/project/test/unit/testtoken.cpp",
+        "/home/user/project/proto/message.pb.cc",
+        "/home/user/project/third_party/json/include/json.hpp",
+        "/home/user/project/lib/legacy/old.c",
+        "/usr/include/stdio.h",
+    };
+}
+
+static void BM_PathMatch_match(benchmark::State& state)
+{
+    const PathMatch pathMatch(patterns, "/home/user/project", PathMatch::Syntax::unix);
+    for (auto _ : state) {
+        for (const std::string& path : paths)
+            benchmark::DoNotOptimize(pathMatch.match(path));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * paths.size()));
+}
+BENCHMARK(BM_PathMatch_match);
+
+static void BM_PathMatch_match_windows(benchmark::State& state)
+{
+    const PathMatch pathMatch(patterns, "C:\\Users\\user\\project", PathMatch::Syntax::windows);
+    std::vector<std::string> windowsPaths;
+    for (std::string path : paths) {
+        for (char& c : path) {
+            if (c == '/')
+                c = '\\';
+        }
+        windowsPaths.push_back("C:" + path);
+    }
+    for (auto _ : state) {
+        for (const std::string& path : windowsPaths)
+            benchmark::DoNotOptimize(pathMatch.match(path));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * windowsPaths.size()));
+}
+BENCHMARK(BM_PathMatch_match_windows);
+
+static void BM_PathMatch_match_single(benchmark::State& state)
+{
+    for (auto _ : state) {
+        for (const std::string& path : paths)
+            benchmark::DoNotOptimize(PathMatch::match("src/**/*.cpp", path, "/home/user/project", PathMatch::Filemode::regular, PathMatch::Syntax::unix));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * paths.size()));
+}
+BENCHMARK(BM_PathMatch_match_single);
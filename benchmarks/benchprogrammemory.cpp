@@ -0,0 +1,124 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.h"
+#include "color.h"
+#include "errorlogger.h"
+#include "mathlib.h"
+#include "programmemory.h"
+#include "settings.h"
+#include "standards.h"
+#include "token.h"
+#include "tokenize.h"
+#include "tokenlist.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    class NullErrorLogger : public ErrorLogger {
+    public:
+        void reportOut(const std::string & /*outmsg*/, Color /*c*/) override {}
+        void reportErr(const ErrorMessage & /*msg*/) override {}
+        void reportMetric(const std::string & /*metric*/) override {}
+    };
+
+    /** a tokenized function with the given amount of variables */
+    class Variables {
+    public:
+        explicit Variables(std::int64_t count) : mTokenizer(TokenList(mSettings, Standards::Language::CPP), mErrorLogger) {
+            std::string code = "void f() {\n";
+            for (std::int64_t i = 0; i < count; ++i)
+                code += "    int v" + std::to_string(i) + " = " + std::to_string(i) + ";\n";
+            code += "}\n";
+            mTokenizer.list.appendFileIfNew("bench.cpp");
+            if (!mTokenizer.list.createTokensFromBuffer(code.data(), code.size()) || !mTokenizer.simplifyTokens1(""))
+                throw std::runtime_error("tokenizing failed");
+            for (const Token* tok = mTokenizer.tokens(); tok; tok = tok->next()) {
+                if (tok->varId() > 0 && tok->exprId() > 0)
+                    mTokens.push_back(tok);
+            }
+        }
+
+        const std::vector<const Token*>& tokens() const {
+            return mTokens;
+        }
+
+    private:
+        const Settings mSettings;
+        NullErrorLogger mErrorLogger;
+        Tokenizer mTokenizer;
+        std::vector<const Token*> mTokens;
+    };
+
+    ProgramMemory createProgramMemory(const Variables& variables)
+    {
+        ProgramMemory pm;
+        MathLib::bigint i = 0;
+        for (const Token* tok : variables.tokens())
+            pm.setIntValue(tok, ++i);
+        return pm;
+    }
+}
+
+static void BM_ProgramMemory_setIntValue(benchmark::State& state)
+{
+    const Variables variables(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(createProgramMemory(variables));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * variables.tokens().size()));
+}
+BENCHMARK(BM_ProgramMemory_setIntValue)->Arg(16)->Arg(256);
+
+static void BM_ProgramMemory_getValue(benchmark::State& state)
+{
+    const Variables variables(state.range(0));
+    const ProgramMemory pm = createProgramMemory(variables);
+    for (auto _ : state) {
+        for (const Token* tok : variables.tokens())
+            benchmark::DoNotOptimize(pm.getValue(tok->exprId()));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * variables.tokens().size()));
+}
+BENCHMARK(BM_ProgramMemory_getValue)->Arg(16)->Arg(256);
+
+static void BM_ProgramMemory_hasValue_missing(benchmark::State& state)
+{
+    const Variables variables(state.range(0));
+    const ProgramMemory pm = createProgramMemory(variables);
+    const nonneg int missing = variables.tokens().back()->exprId() + 1000;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(pm.hasValue(missing));
+}
+BENCHMARK(BM_ProgramMemory_hasValue_missing)->Arg(16)->Arg(256);
+
+static void BM_ProgramMemory_copyAndModify(benchmark::State& state)
+{
+    const Variables variables(state.range(0));
+    const ProgramMemory pm = createProgramMemory(variables);
+    const Token* const tok = variables.tokens().front();
+    for (auto _ : state) {
+        // the copy is shared until it is modified
+        ProgramMemory copy = pm;
+        copy.setIntValue(tok, 42);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_ProgramMemory_copyAndModify)->Arg(16)->Arg(256);
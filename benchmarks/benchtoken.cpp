@@ -0,0 +1,121 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.h"
+#include "settings.h"
+#include "standards.h"
+#include "token.h"
+#include "tokenlist.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    /** a stable token list with a mix of declarations, expressions, calls and control flow */
+    class Tokens {
+    public:
+        explicit Tokens(std::int64_t statements) : mList(mSettings, Standards::Language::CPP) {
+            std::string code;
+            for (std::int64_t i = 0; i < statements; ++i) {
+                const std::string n = std::to_string(i);
+                code += "int x" + n + " = a [ " + n + " ] + f ( b , c" + n + " ) ;\n";
+                code += "if ( x" + n + " > 0 ) { x" + n + " += 1 ; }\n";
+                code += "s . m" + n + " = p -> q ( 0x10 , \"str\" ) ;\n";
+            }
+            code += "end ;\n";
+            if (!mList.createTokensFromBuffer(code.data(), code.size()))
+                throw std::runtime_error("creating tokens failed");
+            for (const Token* tok = mList.front(); tok; tok = tok->next())
+                ++mSize;
+        }
+
+        const Token* front() const {
+            return mList.front();
+        }
+        std::int64_t size() const {
+            return mSize;
+        }
+
+    private:
+        const Settings mSettings;
+        TokenList mList;
+        std::int64_t mSize{};
+    };
+}
+
+static void BM_TokenMatch_single(benchmark::State& state)
+{
+    const Tokens tokens(state.range(0));
+    for (auto _ : state) {
+        int count = 0;
+        for (const Token* tok = tokens.front(); tok; tok = tok->next())
+            count += Token::Match(tok, "%name% (");
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * tokens.size());
+}
+BENCHMARK(BM_TokenMatch_single)->Arg(100)->Arg(10000);
+
+static void BM_TokenMatch_multi(benchmark::State& state)
+{
+    const Tokens tokens(state.range(0));
+    for (auto _ : state) {
+        int count = 0;
+        for (const Token* tok = tokens.front(); tok; tok = tok->next())
+            count += Token::Match(tok, "%name% =|+=|-= %num%|%name% ;|+");
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * tokens.size());
+}
+BENCHMARK(BM_TokenMatch_multi)->Arg(100)->Arg(10000);
+
+static void BM_TokenMatch_negated(benchmark::State& state)
+{
+    const Tokens tokens(state.range(0));
+    for (auto _ : state) {
+        int count = 0;
+        for (const Token* tok = tokens.front(); tok; tok = tok->next())
+            count += Token::Match(tok, "if|while|for ( !!) %any%");
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * tokens.size());
+}
+BENCHMARK(BM_TokenMatch_negated)->Arg(100)->Arg(10000);
+
+static void BM_TokenSimpleMatch(benchmark::State& state)
+{
+    const Tokens tokens(state.range(0));
+    for (auto _ : state) {
+        int count = 0;
+        for (const Token* tok = tokens.front(); tok; tok = tok->next())
+            count += Token::simpleMatch(tok, "f ( b ,");
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * tokens.size());
+}
+BENCHMARK(BM_TokenSimpleMatch)->Arg(100)->Arg(10000);
+
+static void BM_TokenFindsimplematch(benchmark::State& state)
+{
+    const Tokens tokens(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Token::findsimplematch(tokens.front(), "end ;"));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * tokens.size());
+}
+BENCHMARK(BM_TokenFindsimplematch)->Arg(100)->Arg(10000);
@@ -33,6 +33,7 @@
 #include "library.h"
 #include "path.h"
 #include "pathmatch.h"
+#include "perfcounters.h"
 #include "platform.h"
 #include "settings.h"
 #include "standards.h"
@@ -973,6 +974,14 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             }
         }
 
+        else if (std::strncmp(argv[i], "--limits-report=", 16) == 0) {
+            mSettings.limitsReportFile = argv[i] + 16;
+            if (mSettings.limitsReportFile.empty()) {
+                mLogger.printError("no file specified for the '--limits-report' option.");
+                return Result::Fail;
+            }
+        }
+
         // Set maximum number of #ifdef configurations to check
         else if (std::strncmp(argv[i], "--max-configs=", 14) == 0) {
             int tmp;
@@ -1166,6 +1175,26 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             }
         }
 
+        else if (std::strncmp(argv[i], "--progress-stream=", 18) == 0) {
+            const std::string target = argv[i] + 18;
+            if (startsWith(target, "fd:")) {
+                int fd = -1;
+                if (!strToInt(target.substr(3), fd) || fd < 0) {
+                    mLogger.printError("argument to '--progress-stream=fd:' is not a valid file descriptor.");
+                    return Result::Fail;
+                }
+            } else if (startsWith(target, "unix:") && target.size() > 5) {
+#ifdef _WIN32
+                mLogger.printError("'--progress-stream=unix:' is not supported on Windows.");
+                return Result::Fail;
+#endif
+            } else {
+                mLogger.printError("argument to '--progress-stream' needs to be 'fd:<n>' or 'unix:<path>'.");
+                return Result::Fail;
+            }
+            mSettings.progressStream = target;
+        }
+
         // --project
         else if (std::strncmp(argv[i], "--project=", 10) == 0) {
             if (projectType != ImportProject::Type::NONE)
@@ -1274,6 +1303,11 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
                 return Result::Fail;
         }
 
+        else if (std::strncmp(argv[i], "--report-slowest=", 17) == 0) {
+            if (!parseNumberArg(argv[i], 17, mSettings.reportSlowest, true))
+                return Result::Fail;
+        }
+
         else if (std::strncmp(argv[i], "--report-type=", 14) == 0) {
             const std::string typeStr = argv[i] + 14;
             if (typeStr == "normal") {
@@ -1434,6 +1468,13 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
         else if (std::strcmp(argv[i], "--safety") == 0)
             mSettings.safety = true;
 
+        // show memory usage information..
+        else if (std::strcmp(argv[i], "--showmemory") == 0)
+            mSettings.showmemory = true;
+
+        else if (std::strcmp(argv[i], "--showcounters") == 0)
+            mSettings.showcounters = true;
+
         // show timing information..
         else if (std::strncmp(argv[i], "--showtime=", 11) == 0) {
             const std::string showtimeMode = argv[i] + 11;
@@ -1553,6 +1594,14 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
                 return Result::Fail;
         }
 
+        else if (std::strncmp(argv[i], "--trace=", 8) == 0) {
+            mSettings.traceFile = argv[i] + 8;
+            if (mSettings.traceFile.empty()) {
+                mLogger.printError("no file specified for the '--trace' option.");
+                return Result::Fail;
+            }
+        }
+
         else if (std::strncmp(argv[i], "--typedef-max-time=", 19) == 0) {
             if (!parseNumberArg(argv[i], 19, mSettings.typedefMaxTime))
                 return Result::Fail;
@@ -1606,6 +1655,19 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
         }
     }
 
+    if (mSettings.showcounters) {
+        if (mSettings.showtime == Settings::ShowTime::NONE) {
+            mLogger.printMessage("'--showcounters' has no effect without '--showtime'.");
+            mSettings.showcounters = false;
+        } else {
+            const std::string err = PerfCounters::error();
+            if (!err.empty()) {
+                mLogger.printMessage("'--showcounters' has no effect - " + err + ".");
+                mSettings.showcounters = false;
+            }
+        }
+    }
+
     // TODO: bail out?
     if (!executorAuto && mSettings.useSingleJob())
         mLogger.printMessage("'--executor' has no effect as only a single job will be used.");
@@ -1690,6 +1752,11 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
         }
     }
 
+    if (mSettings.reportSlowest > 0 && mSettings.buildDir.empty()) {
+        mLogger.printError("'--report-slowest' requires '--cppcheck-build-dir'.");
+        return Result::Fail;
+    }
+
     if (!mSettings.buildDir.empty() && !Path::isDirectory(mSettings.buildDir)) {
         mLogger.printError("Directory '" + mSettings.buildDir + "' specified by --cppcheck-build-dir argument has to be existent.");
         return Result::Fail;
@@ -1887,6 +1954,12 @@ void CmdLineParser::printHelp() const
         "                         distributed with Cppcheck is loaded automatically.\n"
         "                         For more information about library files, read the\n"
         "                         manual.\n"
+        "    --limits-report=<file>\n"
+        "                         Write a record of each analysis limit which was hit\n"
+        "                         to the given XML file. It contains the file, the\n"
+        "                         function, the limit and the work and time spent so\n"
+        "                         far. Use it to see where '--check-level' or the\n"
+        "                         individual limits cut the analysis short.\n"
         "    --max-configs=<limit>\n"
         "                         Maximum number of configurations to check in a file\n"
         "                         before skipping it. Default is '12'. If used together\n"
@@ -1967,6 +2040,13 @@ void CmdLineParser::printHelp() const
     }
 
     oss <<
+        "    --progress-stream=<target>\n"
+        "                         Write the progress of the analysis as JSON lines to\n"
+        "                         a file descriptor (fd:<n>) or a UNIX socket\n"
+        "                         (unix:<path>). Each line contains the file and phase\n"
+        "                         each job is working on, the files and tokens per\n"
+        "                         second, the amount of queued files and the estimated\n"
+        "                         remaining time.\n"
         "    --project=<file>     Run Cppcheck on project. The <file> can be a Visual\n"
         "                         Studio Solution (*.sln) or (*.slnx), Visual Studio Project\n"
         "                         (*.vcxproj), compile database (compile_commands.json),\n"
@@ -1989,6 +2069,11 @@ void CmdLineParser::printHelp() const
         "                         currently only possible to apply the base paths to\n"
         "                         files that are on a lower level in the directory tree.\n"
         "    --report-progress    Report progress messages while checking a file (single job only).\n"
+        "    --report-slowest=<n> Report the <n> files which took the longest to analyze\n"
+        "                         and how their analysis time and slowest phases changed\n"
+        "                         compared to the previous runs. The timings of the last\n"
+        "                         runs of each file are recorded in the analyzer\n"
+        "                         information. Requires --cppcheck-build-dir.\n"
         "    --report-type=<type> Add guideline and classification fields for specified coding standard.\n"
         "                         The available report types are:\n"
         "                          * normal           Default, only show cppcheck error ID and severity\n"
@@ -2006,6 +2091,17 @@ void CmdLineParser::printHelp() const
         "    --safety             Enable safety-certified checking mode: display checker summary, enforce\n"
         "                         stricter checks for critical errors, and return a non-zero exit code\n"
         "                         if such errors occur.\n"
+        "    --showcounters       Show the hardware performance counters (cycles,\n"
+        "                         instructions, cache misses and branch misses) of each\n"
+        "                         timed phase with --showtime. Only available on Linux\n"
+        "                         if the hardware counters can be accessed.\n"
+        "    --showmemory         Show memory usage information for each processed file.\n"
+        "                         It contains the growth of the resident set size (RSS)\n"
+        "                         for each timed phase, the estimated size of the main\n"
+        "                         data structures and the peak RSS of the process. A\n"
+        "                         summary with the peak RSS is shown at the end. The RSS\n"
+        "                         includes the memory of other threads when using -j\n"
+        "                         with --executor=thread.\n"
         "    --showtime=<mode>    Show timing information.\n"
         "                         The available modes are:\n"
         "                          * none\n"
@@ -2086,6 +2182,10 @@ void CmdLineParser::printHelp() const
         "                           \\r         insert carriage return\n"
         "                         Example format (gcc-like):\n"
         "                         '{file}:{line}:{column}: note: {info}\\n{code}'\n"
+        "    --trace=<file>       Write a trace of the analysis to the given file. It\n"
+        "                         contains the timed phases of each file with their\n"
+        "                         configuration and thread in the Chrome trace event\n"
+        "                         format which can be loaded into a trace viewer.\n"
         "    -U<ID>               Undefine preprocessor symbol. Use -U to explicitly\n"
         "                         hide certain #ifdef <ID> code paths from checking.\n"
         "                         Example: '-UDEBUG'\n"
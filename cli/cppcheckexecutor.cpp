@@ -33,6 +33,7 @@
 #include "errortypes.h"
 #include "filesettings.h"
 #include "path.h"
+#include "progressstream.h"
 #include "sarifreport.h"
 #include "settings.h"
 #include "singleexecutor.h"
@@ -138,7 +139,12 @@ namespace {
 
         void reportMetric(const std::string &metric) override
         {
-            mFileMetrics.push_back(metric);
+            if (ErrorLogger::isLimitMetric(metric)) {
+                // a limit might be hit by many analyses of the same function - only the first one is reported
+                if (mLimitKeys.insert(metric.substr(0, metric.find(" limit="))).second)
+                    mLimits.push_back(metric);
+            } else
+                mFileMetrics.push_back(metric);
         }
 
         void reportMetrics()
@@ -158,6 +164,11 @@ namespace {
          */
         void writeCheckersReport(const Suppressions& supprs);
 
+        /**
+         * @brief Write the analysis limits which were hit
+         */
+        void writeLimitsReport() const;
+
         bool hasCriticalErrors() const {
             return !mCriticalErrors.empty();
         }
@@ -248,6 +259,16 @@ namespace {
          */
         std::vector<std::string> mFileMetrics;
 
+        /**
+         * Analysis limits which were hit
+         */
+        std::vector<std::string> mLimits;
+
+        /**
+         * The file, function and id of the reported limits
+         */
+        std::unordered_set<std::string> mLimitKeys;
+
         /**
          * The file the cached active checkers are stored in
          */
@@ -422,8 +443,25 @@ int CppCheckExecutor::check_internal(const Settings& settings, Suppressions& sup
 {
     StdLogger stdLogger(settings);
     std::unique_ptr<TimerResults> timerResults;
-    if (settings.showtime != Settings::ShowTime::NONE)
+    // the timer results are also needed for the timings of the phases in the analyzer information and the progress stream
+    if (settings.showtime != Settings::ShowTime::NONE || !settings.traceFile.empty() || settings.showmemory || !settings.buildDir.empty() || !settings.progressStream.empty())
         timerResults.reset(new TimerResults);
+    if (!settings.traceFile.empty())
+        timerResults->setTrace(true);
+    if (settings.showmemory)
+        timerResults->setMemory(true);
+    if (settings.showcounters)
+        timerResults->setCounters(true);
+
+    std::unique_ptr<ProgressStream> progressStream;
+    if (!settings.progressStream.empty()) {
+        progressStream.reset(new ProgressStream);
+        const std::string err = progressStream->open(settings.progressStream);
+        if (!err.empty()) {
+            std::cout << "cppcheck: error: could not open the progress stream - " << err << "." << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
 
     if (settings.reportProgress >= 0)
         stdLogger.resetLatestProgressOutputTime();
@@ -450,17 +488,20 @@ int CppCheckExecutor::check_internal(const Settings& settings, Suppressions& sup
     if (settings.useSingleJob()) {
         // Single process
         SingleExecutor executor(cppcheck, mFiles, mFileSettings, settings, supprs, stdLogger, timerResults.get());
+        executor.setProgressStream(progressStream.get());
         returnValue = executor.check();
     } else {
 #if defined(HAS_THREADING_MODEL_THREAD)
         if (settings.executor == Settings::ExecutorType::Thread) {
             ThreadExecutor executor(mFiles, mFileSettings, settings, supprs, stdLogger, timerResults.get(), CppCheckExecutor::executeCommand);
+            executor.setProgressStream(progressStream.get());
             returnValue = executor.check();
         }
 #endif
 #if defined(HAS_THREADING_MODEL_FORK)
         if (settings.executor == Settings::ExecutorType::Process) {
             ProcessExecutor executor(mFiles, mFileSettings, settings, supprs, stdLogger, timerResults.get(), CppCheckExecutor::executeCommand);
+            executor.setProgressStream(progressStream.get());
             returnValue = executor.check();
         }
 #endif
@@ -472,6 +513,15 @@ int CppCheckExecutor::check_internal(const Settings& settings, Suppressions& sup
             timerResults->showResults();
         else if (settings.showtime == Settings::ShowTime::TOP5_SUMMARY)
             timerResults->showResults(5);
+
+        // the measurements of each file have already been shown so this only shows the overall peak RSS
+        if (settings.showmemory)
+            timerResults->showMemory();
+
+        if (!settings.traceFile.empty()) {
+            std::ofstream fout(settings.traceFile);
+            timerResults->writeTrace(fout);
+        }
     }
 
     // TODO: is this run again instead of using previously cached results?
@@ -485,6 +535,18 @@ int CppCheckExecutor::check_internal(const Settings& settings, Suppressions& sup
 
     stdLogger.writeCheckersReport(supprs);
 
+    if (!settings.limitsReportFile.empty())
+        stdLogger.writeLimitsReport();
+
+    if (settings.reportSlowest > 0) {
+        std::vector<AnalyzerInformation::FileTimings> timings;
+        const std::string err = AnalyzerInformation::readTimings(settings.buildDir, timings);
+        if (!err.empty())
+            std::cout << "cppcheck: reading the analysis timings failed - " << err << std::endl;
+        else
+            std::cout << AnalyzerInformation::reportSlowest(std::move(timings), settings.reportSlowest) << std::flush;
+    }
+
     if (settings.outputFormat == Settings::OutputFormat::xml) {
         if (settings.xml_version == 3)
             stdLogger.reportMetrics();
@@ -499,6 +561,16 @@ int CppCheckExecutor::check_internal(const Settings& settings, Suppressions& sup
     return EXIT_SUCCESS;
 }
 
+void StdLogger::writeLimitsReport() const
+{
+    std::ofstream fout(mSettings.limitsReportFile);
+    fout << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl;
+    fout << "<limits>" << std::endl;
+    for (const auto& limit : mLimits)
+        fout << "    " << limit << std::endl;
+    fout << "</limits>" << std::endl;
+}
+
 void StdLogger::writeCheckersReport(const Suppressions& supprs)
 {
     // TODO: only necessary when we actually issue a checkers report?
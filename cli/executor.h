@@ -32,6 +32,7 @@ struct Suppressions;
 struct FileSettings;
 class FileWithDetails;
 class TimerResults;
+class ProgressStream;
 
 /// @addtogroup CLI
 /// @{
@@ -60,6 +61,11 @@ public:
      */
     void reportStatus(std::size_t fileindex, std::size_t filecount, std::size_t sizedone, std::size_t sizetotal);
 
+    /** @brief Also write the machine-readable progress to the given stream */
+    void setProgressStream(ProgressStream* progressStream) {
+        mProgressStream = progressStream;
+    }
+
 protected:
     /**
      * @brief Check if message is being suppressed and unique.
@@ -74,6 +80,7 @@ protected:
     Suppressions &mSuppressions;
     ErrorLogger &mErrorLogger;
     TimerResults *mTimerResults;
+    ProgressStream *mProgressStream{};
 
 private:
     std::mutex mErrorListSync;
@@ -28,6 +28,9 @@
 #include "errorlogger.h"
 #include "errortypes.h"
 #include "filesettings.h"
+#include "matchprofiler.h"
+#include "perfcounters.h"
+#include "progressstream.h"
 #include "settings.h"
 #include "suppressions.h"
 #include "timer.h"
@@ -42,6 +45,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <iterator>
 #include <list>
 #include <map>
 #include <sstream>
@@ -51,6 +55,7 @@
 #include <sys/wait.h>
 #include <unistd.h>
 #include <utility>
+#include <vector>
 #include <fcntl.h>
 
 
@@ -78,7 +83,7 @@ ProcessExecutor::ProcessExecutor(const std::list<FileWithDetails> &files, const
 namespace {
     class PipeWriter : public ErrorLogger {
     public:
-        enum PipeSignal : std::uint8_t {REPORT_OUT='1',REPORT_ERROR='2',REPORT_SUPPR_INLINE='3',REPORT_SUPPR='4',CHILD_END='5',REPORT_METRIC='6',REPORT_TIMER='7'};
+        enum PipeSignal : std::uint8_t {REPORT_OUT='1',REPORT_ERROR='2',REPORT_SUPPR_INLINE='3',REPORT_SUPPR='4',CHILD_END='5',REPORT_METRIC='6',REPORT_TIMER='7',REPORT_TRACE='8',REPORT_MEMORY='9',REPORT_COUNTERS='A',REPORT_PHASE='B',REPORT_TOKENS='C',REPORT_MATCH_PROFILE='D'};
 
         explicit PipeWriter(int pipe, bool debug) : mWpipe(pipe), mDebug(debug) {}
 
@@ -110,12 +115,51 @@ namespace {
 
             for (const auto& entry : timerResults->getResults())
             {
-                for (const auto& d : entry.second) {
-                    writeToPipe(REPORT_TIMER, entry.first + ";" + std::to_string(d.count()));
+                const TimerStats& stats = entry.second;
+                writeToPipe(REPORT_TIMER, entry.first + ";" + std::to_string(stats.count) + ";" + std::to_string(stats.sum.count()) + ";" + std::to_string(stats.min.count()) + ";" + std::to_string(stats.max.count()));
+            }
+            for (const std::string& event : timerResults->getTraceEvents())
+                writeToPipe(REPORT_TRACE, event);
+            for (const auto& entry : timerResults->getCounters())
+            {
+                // a counter which is not available is empty
+                std::string str = entry.first;
+                for (std::size_t i = 0; i < PerfCounters::EVENT_COUNT; ++i) {
+                    str += ";";
+                    if (entry.second.valid[i])
+                        str += std::to_string(entry.second.counts[i]);
                 }
+                writeToPipe(REPORT_COUNTERS, str);
             }
         }
 
+        void writeMemory(const TimerResults* timerResults) const {
+            if (!timerResults || !timerResults->measureMemory())
+                return;
+
+            writeToPipe(REPORT_MEMORY, std::to_string(timerResults->getPeakRss()));
+        }
+
+        void writePhase(const std::string& phase) {
+            // the same phase is entered repeatedly when nested measurements are stopped
+            if (phase == mPhase)
+                return;
+            mPhase = phase;
+            writeToPipe(REPORT_PHASE, phase);
+        }
+
+        void writeTokens(std::size_t tokens) const {
+            writeToPipe(REPORT_TOKENS, std::to_string(tokens));
+        }
+
+        void writeMatchProfile() const {
+#ifdef CPPCHECK_MATCH_PROFILING
+            // the report is only written by the main process
+            for (const std::string& results : MatchProfiler::takeResults())
+                writeToPipe(REPORT_MATCH_PROFILE, results);
+#endif
+        }
+
         void writeEnd(const std::string& str) const {
             writeToPipe(CHILD_END, str);
         }
@@ -173,10 +217,11 @@ namespace {
 
         const int mWpipe;
         const bool mDebug;
+        std::string mPhase;
     };
 }
 
-bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::string& filename)
+bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::string& filename, std::size_t worker, std::size_t &tokens)
 {
     std::size_t bytes_to_read;
     ssize_t bytes_read;
@@ -205,7 +250,13 @@ bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::str
         type != PipeWriter::REPORT_SUPPR &&
         type != PipeWriter::CHILD_END &&
         type != PipeWriter::REPORT_METRIC &&
-        type != PipeWriter::REPORT_TIMER) {
+        type != PipeWriter::REPORT_TIMER &&
+        type != PipeWriter::REPORT_TRACE &&
+        type != PipeWriter::REPORT_MEMORY &&
+        type != PipeWriter::REPORT_COUNTERS &&
+        type != PipeWriter::REPORT_PHASE &&
+        type != PipeWriter::REPORT_TOKENS &&
+        type != PipeWriter::REPORT_MATCH_PROFILE) {
         std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") invalid type " << int(type) << std::endl;
         std::exit(EXIT_FAILURE);
     }
@@ -299,13 +350,62 @@ bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::str
             std::exit(EXIT_FAILURE);
         }
         const auto parts = splitString(buf, ';');
-        if (parts.size() < 2)
+        if (parts.size() < 5)
         {
             // TODO: make this non-fatal
             std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") adding of timer result failed - insufficient data" << std::endl;
             std::exit(EXIT_FAILURE);
         }
-        mTimerResults->addResults(parts[0], std::chrono::milliseconds{strToInt<long>(parts[1])});
+        TimerStats stats;
+        stats.count = strToInt<std::size_t>(parts[1]);
+        stats.sum = std::chrono::nanoseconds{strToInt<long long>(parts[2])};
+        stats.min = std::chrono::nanoseconds{strToInt<long long>(parts[3])};
+        stats.max = std::chrono::nanoseconds{strToInt<long long>(parts[4])};
+        mTimerResults->addResults(parts[0], stats);
+    } else if (type == PipeWriter::REPORT_TRACE) {
+        if (!mTimerResults) {
+            // TODO: make this non-fatal
+            std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") received trace events when no timer is enabled" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        mTimerResults->addTraceEvent(buf);
+    } else if (type == PipeWriter::REPORT_MEMORY) {
+        if (!mTimerResults) {
+            // TODO: make this non-fatal
+            std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") received memory results when no timer is enabled" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        mTimerResults->addPeakRss(strToInt<std::size_t>(buf));
+    } else if (type == PipeWriter::REPORT_COUNTERS) {
+        if (!mTimerResults) {
+            // TODO: make this non-fatal
+            std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") received counter results when no timer is enabled" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        const auto parts = splitString(buf, ';');
+        if (parts.size() < 1 + PerfCounters::EVENT_COUNT)
+        {
+            // TODO: make this non-fatal
+            std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") adding of counter result failed - insufficient data" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        PerfCounters::Values counters;
+        for (std::size_t i = 0; i < PerfCounters::EVENT_COUNT; ++i) {
+            if (parts[1 + i].empty())
+                continue;
+            counters.counts[i] = strToInt<std::uint64_t>(parts[1 + i]);
+            counters.valid[i] = true;
+        }
+        mTimerResults->addCounters(parts[0], counters);
+    } else if (type == PipeWriter::REPORT_PHASE) {
+        if (mProgressStream)
+            mProgressStream->setPhase(worker, buf);
+    } else if (type == PipeWriter::REPORT_TOKENS) {
+        tokens += strToInt<std::size_t>(buf);
+    } else if (type == PipeWriter::REPORT_MATCH_PROFILE) {
+#ifdef CPPCHECK_MATCH_PROFILING
+        MatchProfiler::addResults(buf);
+#endif
     }
 
     return res;
@@ -348,9 +448,16 @@ unsigned int ProcessExecutor::check()
     supprs.nomsg.addSuppressions(mSuppressions.nomsg.getSuppressions());
     supprs.nofail.addSuppressions(mSuppressions.nofail.getSuppressions());
 
+    if (mProgressStream)
+        mProgressStream->start("process", mSettings.jobs, mFiles.size() + mFileSettings.size(), totalfilesize);
+
     std::list<int> rpipes;
     std::map<pid_t, std::string> childFile;
     std::map<int, std::string> pipeFile;
+    // the worker of each child in the progress stream and the amount of tokens it has analyzed
+    std::vector<bool> busyWorkers(mSettings.jobs);
+    std::map<int, std::size_t> pipeWorker;
+    std::map<int, std::size_t> pipeTokens;
     std::size_t processedsize = 0;
     auto iFile = mFiles.cbegin();
     auto iFileSettings = mFileSettings.cbegin();
@@ -386,12 +493,26 @@ unsigned int ProcessExecutor::check()
 #endif
                 close(pipes[0]);
 
+#ifdef CPPCHECK_MATCH_PROFILING
+                // drop the results which have been inherited from the main process
+                (void)MatchProfiler::takeResults();
+#endif
+
                 // create a separate result object so we do not get the results which have already been transferred back
                 std::unique_ptr<TimerResults> timerResults;
-                if (mTimerResults)
+                if (mTimerResults) {
                     timerResults.reset(new TimerResults);
+                    timerResults->setTrace(!mSettings.traceFile.empty());
+                    timerResults->setMemory(mSettings.showmemory);
+                    timerResults->setCounters(mSettings.showcounters);
+                }
 
                 PipeWriter pipewriter(pipes[1], mSettings.debugipc);
+                if (mProgressStream && timerResults) {
+                    timerResults->setPhaseListener([&pipewriter](const std::string& phase) {
+                        pipewriter.writePhase(phase);
+                    });
+                }
                 CppCheck fileChecker(mSettings, supprs, pipewriter, timerResults.get(), false, mExecuteCommand);
                 unsigned int resultOfCheck = 0;
 
@@ -402,9 +523,17 @@ unsigned int ProcessExecutor::check()
                     resultOfCheck = fileChecker.check(*iFile);
                 }
 
+                if (mProgressStream) {
+                    if (timerResults)
+                        timerResults->setPhaseListener(nullptr);
+                    pipewriter.writeTokens(fileChecker.getAnalyzedTokens());
+                }
+
                 pipewriter.writeSuppr(supprs.nomsg);
 
                 pipewriter.writeTimer(timerResults.get());
+                pipewriter.writeMemory(timerResults.get());
+                pipewriter.writeMatchProfile();
 
                 pipewriter.writeEnd(std::to_string(resultOfCheck));
                 std::exit(EXIT_SUCCESS);
@@ -421,6 +550,16 @@ unsigned int ProcessExecutor::check()
                 pipeFile[pipes[0]] = iFile->path();
                 ++iFile;
             }
+
+            // the children are limited by the amount of jobs so a worker is usually free
+            auto worker = std::find(busyWorkers.begin(), busyWorkers.end(), false);
+            if (worker == busyWorkers.end())
+                worker = busyWorkers.insert(worker, false);
+            *worker = true;
+            pipeWorker[pipes[0]] = static_cast<std::size_t>(std::distance(busyWorkers.begin(), worker));
+            pipeTokens[pipes[0]] = 0;
+            if (mProgressStream)
+                mProgressStream->startFile(pipeWorker[pipes[0]], pipeFile[pipes[0]]);
         }
         if (!rpipes.empty()) {
             fd_set rfds;
@@ -441,7 +580,8 @@ unsigned int ProcessExecutor::check()
                         if (p != pipeFile.cend()) {
                             name = p->second;
                         }
-                        const bool readRes = handleRead(*rp, result, name);
+                        const std::size_t worker = pipeWorker[*rp];
+                        const bool readRes = handleRead(*rp, result, name, worker, pipeTokens[*rp]);
                         if (!readRes) {
                             std::size_t size = 0;
                             if (p != pipeFile.cend()) {
@@ -459,6 +599,12 @@ unsigned int ProcessExecutor::check()
                             if (!mSettings.quiet)
                                 Executor::reportStatus(fileCount, mFiles.size() + mFileSettings.size(), processedsize, totalfilesize);
 
+                            if (mProgressStream)
+                                mProgressStream->finishFile(worker, size, pipeTokens[*rp]);
+                            busyWorkers[worker] = false;
+                            pipeWorker.erase(*rp);
+                            pipeTokens.erase(*rp);
+
                             close(*rp);
                             rp = rpipes.erase(rp);
                         } else
@@ -467,6 +613,8 @@ unsigned int ProcessExecutor::check()
                         ++rp;
                 }
             }
+            if (mProgressStream)
+                mProgressStream->poll();
         }
         if (!childFile.empty()) {
             int stat = 0;
@@ -501,6 +649,9 @@ unsigned int ProcessExecutor::check()
 
     // TODO: we need to get the timing information from the subprocess
 
+    if (mProgressStream)
+        mProgressStream->finish();
+
     return result;
 }
 
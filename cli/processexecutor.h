@@ -55,9 +55,14 @@ public:
 private:
     /**
      * Read from the pipe, parse and handle what ever is in there.
+     * @param rpipe    the pipe to read from
+     * @param result   the result of the check is added to it
+     * @param filename the file which is checked by the child
+     * @param worker   the worker which the child is reported as in the progress stream
+     * @param tokens   the amount of analyzed tokens is added to it
      * @return False in case of an recoverable error - will exit process on others
      */
-    bool handleRead(int rpipe, unsigned int &result, const std::string& filename);
+    bool handleRead(int rpipe, unsigned int &result, const std::string& filename, std::size_t worker, std::size_t &tokens);
 
     /**
      * @brief Check load average condition
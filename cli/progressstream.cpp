@@ -0,0 +1,267 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "progressstream.h"
+
+#include "json.h"
+#include "utils.h"
+
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#if !defined(_WIN32) && !defined(MSG_NOSIGNAL)
+#define MSG_NOSIGNAL 0 // SO_NOSIGPIPE is set on the socket instead
+#endif
+
+static double toSeconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+}
+
+static picojson::value toJson(std::size_t value)
+{
+    return picojson::value(static_cast<std::int64_t>(value));
+}
+
+ProgressStream::~ProgressStream()
+{
+#ifndef _WIN32
+    if (mOwnsFd)
+        ::close(mFd);
+#endif
+}
+
+std::string ProgressStream::open(const std::string &target)
+{
+    if (startsWith(target, "fd:")) {
+        int fd = -1;
+        if (!strToInt(target.substr(3), fd) || fd < 0)
+            return "invalid file descriptor '" + target.substr(3) + "'";
+#ifndef _WIN32
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+            return "file descriptor " + std::to_string(fd) + " is not open - " + std::strerror(errno);
+        mSocket = S_ISSOCK(st.st_mode);
+        // a pipe cannot be written without SIGPIPE so it is ignored to continue the analysis when the reader goes away
+        if (!mSocket)
+            std::signal(SIGPIPE, SIG_IGN);
+#endif
+        mFd = fd;
+        return "";
+    }
+    if (startsWith(target, "unix:")) {
+#ifdef _WIN32
+        return "UNIX sockets are not supported on Windows";
+#else
+        const std::string path = target.substr(5);
+        sockaddr_un addr;
+        std::memset(&addr, 0, sizeof(addr));
+        if (path.empty() || path.size() >= sizeof(addr.sun_path))
+            return "invalid socket path '" + path + "'";
+        addr.sun_family = AF_UNIX;
+        std::memcpy(addr.sun_path, path.c_str(), path.size());
+
+        const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+            return std::string("socket() failed - ") + std::strerror(errno);
+#if defined(SO_NOSIGPIPE)
+        const int on = 1;
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+        if (connect(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+            const int err = errno;
+            ::close(fd);
+            return "could not connect to '" + path + "' - " + std::strerror(err);
+        }
+        mFd = fd;
+        mOwnsFd = true;
+        mSocket = true;
+        return "";
+#endif
+    }
+    return "invalid target '" + target + "'";
+}
+
+void ProgressStream::start(const std::string &executor, std::size_t workers, std::size_t files, std::size_t size)
+{
+    std::lock_guard<std::mutex> l(mSync);
+    mStart = Clock::now();
+    mLastProgress = mStart;
+    mWorkers.assign(workers, Worker{});
+    mTotalFiles = files;
+    mTotalSize = size;
+
+    picojson::object event;
+    event["event"] = picojson::value("start");
+    event["executor"] = picojson::value(executor);
+    event["workers"] = toJson(workers);
+    event["files_total"] = toJson(files);
+    event["size_total"] = toJson(size);
+    write(picojson::value(std::move(event)).serialize());
+}
+
+void ProgressStream::startFile(std::size_t worker, const std::string &file)
+{
+    std::lock_guard<std::mutex> l(mSync);
+    if (worker >= mWorkers.size())
+        mWorkers.resize(worker + 1);
+    Worker &w = mWorkers[worker];
+    w.file = file;
+    w.phase.clear();
+    w.start = Clock::now();
+    if (w.start - mLastProgress >= std::chrono::seconds(1))
+        writeProgress(w.start);
+}
+
+void ProgressStream::setPhase(std::size_t worker, const std::string &phase)
+{
+    std::lock_guard<std::mutex> l(mSync);
+    if (worker >= mWorkers.size())
+        return;
+    mWorkers[worker].phase = phase;
+    const Clock::time_point now = Clock::now();
+    if (now - mLastProgress >= std::chrono::seconds(1))
+        writeProgress(now);
+}
+
+void ProgressStream::finishFile(std::size_t worker, std::size_t size, std::size_t tokens)
+{
+    std::lock_guard<std::mutex> l(mSync);
+    if (worker < mWorkers.size())
+        mWorkers[worker] = Worker{};
+    ++mDoneFiles;
+    mDoneSize += size;
+    mDoneTokens += tokens;
+    writeProgress(Clock::now());
+}
+
+void ProgressStream::poll()
+{
+    std::lock_guard<std::mutex> l(mSync);
+    const Clock::time_point now = Clock::now();
+    if (now - mLastProgress >= std::chrono::seconds(1))
+        writeProgress(now);
+}
+
+void ProgressStream::finish()
+{
+    std::lock_guard<std::mutex> l(mSync);
+    const double elapsed = toSeconds(Clock::now() - mStart);
+
+    picojson::object event;
+    event["event"] = picojson::value("finish");
+    event["elapsed"] = picojson::value(elapsed);
+    event["files_done"] = toJson(mDoneFiles);
+    event["size_done"] = toJson(mDoneSize);
+    event["tokens_done"] = toJson(mDoneTokens);
+    write(picojson::value(std::move(event)).serialize());
+}
+
+void ProgressStream::writeProgress(Clock::time_point now)
+{
+    mLastProgress = now;
+    const double elapsed = toSeconds(now - mStart);
+
+    picojson::array workers;
+    std::size_t busy = 0;
+    for (std::size_t i = 0; i < mWorkers.size(); ++i) {
+        const Worker &w = mWorkers[i];
+        picojson::object worker;
+        worker["id"] = toJson(i);
+        if (w.file.empty()) {
+            worker["file"] = picojson::value();
+            worker["phase"] = picojson::value();
+        } else {
+            ++busy;
+            worker["file"] = picojson::value(w.file);
+            worker["phase"] = picojson::value(w.phase);
+            worker["elapsed"] = picojson::value(toSeconds(now - w.start));
+        }
+        workers.emplace_back(std::move(worker));
+    }
+
+    // the size of the files is not known for projects so the amount of files is used instead
+    double done = 0;
+    if (mTotalSize > 0)
+        done = static_cast<double>(mDoneSize) / static_cast<double>(mTotalSize);
+    else if (mTotalFiles > 0)
+        done = static_cast<double>(mDoneFiles) / static_cast<double>(mTotalFiles);
+
+    picojson::object event;
+    event["event"] = picojson::value("progress");
+    event["elapsed"] = picojson::value(elapsed);
+    event["files_done"] = toJson(mDoneFiles);
+    event["files_total"] = toJson(mTotalFiles);
+    event["size_done"] = toJson(mDoneSize);
+    event["size_total"] = toJson(mTotalSize);
+    event["tokens_done"] = toJson(mDoneTokens);
+    event["queue"] = toJson(mTotalFiles > mDoneFiles + busy ? mTotalFiles - mDoneFiles - busy : 0);
+    event["files_per_second"] = picojson::value(elapsed > 0 ? static_cast<double>(mDoneFiles) / elapsed : 0.0);
+    event["tokens_per_second"] = picojson::value(elapsed > 0 ? static_cast<double>(mDoneTokens) / elapsed : 0.0);
+    event["eta"] = done > 0 ? picojson::value(elapsed * (1 - done) / done) : picojson::value();
+    event["workers"] = picojson::value(std::move(workers));
+    write(picojson::value(std::move(event)).serialize());
+}
+
+void ProgressStream::write(const std::string &event)
+{
+    if (mFd < 0)
+        return;
+
+    const std::string line = event + '\n';
+    const char *data = line.data();
+    std::size_t remaining = line.size();
+    while (remaining > 0) {
+#ifdef _WIN32
+        const int written = _write(mFd, data, static_cast<unsigned int>(remaining));
+#else
+        // a socket is written without SIGPIPE so the analysis continues when the reader goes away - see open() for pipes
+        const ssize_t written = mSocket ? send(mFd, data, remaining, MSG_NOSIGNAL) : ::write(mFd, data, remaining);
+#endif
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0) {
+            if (errno == EPIPE || errno == ECONNRESET)
+                std::cerr << "cppcheck: the reader of the progress stream has gone away - no further progress is written" << std::endl;
+            else
+                std::cerr << "cppcheck: writing the progress stream failed - " << std::strerror(errno) << " - no further progress is written" << std::endl;
+#ifndef _WIN32
+            if (mOwnsFd)
+                ::close(mFd);
+#endif
+            mFd = -1;
+            mOwnsFd = false;
+            return;
+        }
+        data += written;
+        remaining -= static_cast<std::size_t>(written);
+    }
+}
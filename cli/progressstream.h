@@ -0,0 +1,116 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROGRESSSTREAM_H
+#define PROGRESSSTREAM_H
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// @addtogroup CLI
+/// @{
+
+/**
+ * @brief Machine-readable progress of the analysis (--progress-stream).
+ *
+ * Each event is written as a JSON object on a single line to a file
+ * descriptor or a UNIX socket. There is a "start" event, "progress" events
+ * with the file and phase of each worker, the throughput, the amount of
+ * queued files and the estimated remaining time, and a "finish" event.
+ * A progress event is written whenever a file has been analyzed and
+ * otherwise at most once per second. All functions are thread-safe.
+ */
+class ProgressStream {
+public:
+    ProgressStream() = default;
+    ~ProgressStream();
+
+    ProgressStream(const ProgressStream &) = delete;
+    ProgressStream& operator=(const ProgressStream &) = delete;
+
+    /**
+     * @brief Open the stream.
+     * @param target "fd:<n>" for an already opened file descriptor or "unix:<path>" to connect to a UNIX socket
+     * @return error message - empty on success
+     */
+    std::string open(const std::string &target);
+
+    /**
+     * @brief Start the analysis.
+     * @param executor name of the executor
+     * @param workers  amount of files which are analyzed at the same time
+     * @param files    amount of files to analyze
+     * @param size     total size of the files - 0 if unknown
+     */
+    void start(const std::string &executor, std::size_t workers, std::size_t files, std::size_t size);
+
+    /** @brief The worker has started to analyze the given file */
+    void startFile(std::size_t worker, const std::string &file);
+
+    /** @brief The worker has entered the given phase - empty if it is not within a measured phase */
+    void setPhase(std::size_t worker, const std::string &phase);
+
+    /**
+     * @brief The worker has finished its file.
+     * @param worker the worker
+     * @param size   size of the file
+     * @param tokens amount of analyzed tokens
+     */
+    void finishFile(std::size_t worker, std::size_t size, std::size_t tokens);
+
+    /** @brief Write a progress event if it is due */
+    void poll();
+
+    /** @brief The analysis has been finished */
+    void finish();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Worker {
+        std::string file;
+        std::string phase;
+        Clock::time_point start;
+    };
+
+    void writeProgress(Clock::time_point now);
+    void write(const std::string &event);
+
+    std::mutex mSync;
+
+    int mFd{-1};
+    bool mOwnsFd{};
+    bool mSocket{};
+
+    Clock::time_point mStart;
+    Clock::time_point mLastProgress;
+
+    std::vector<Worker> mWorkers;
+    std::size_t mTotalFiles{};
+    std::size_t mTotalSize{};
+    std::size_t mDoneFiles{};
+    std::size_t mDoneSize{};
+    std::size_t mDoneTokens{};
+};
+
+/// @}
+
+#endif // PROGRESSSTREAM_H
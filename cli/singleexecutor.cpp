@@ -20,6 +20,7 @@
 
 #include "cppcheck.h"
 #include "filesettings.h"
+#include "progressstream.h"
 #include "settings.h"
 #include "timer.h"
 
@@ -27,6 +28,7 @@
 #include <cstddef>
 #include <list>
 #include <numeric>
+#include <string>
 
 class ErrorLogger;
 
@@ -49,8 +51,23 @@ unsigned int SingleExecutor::check()
     std::size_t processedsize = 0;
     unsigned int c = 0;
 
+    if (mProgressStream) {
+        mProgressStream->start("single", 1, mFiles.size() + mFileSettings.size(), totalfilesize);
+        if (mTimerResults) {
+            ProgressStream *progressStream = mProgressStream;
+            mTimerResults->setPhaseListener([progressStream](const std::string& phase) {
+                progressStream->setPhase(0, phase);
+            });
+        }
+    }
+
     for (auto i = mFiles.cbegin(); i != mFiles.cend(); ++i) {
+        const std::size_t tokens = mCppcheck.getAnalyzedTokens();
+        if (mProgressStream)
+            mProgressStream->startFile(0, i->path());
         result += mCppcheck.check(*i);
+        if (mProgressStream)
+            mProgressStream->finishFile(0, i->size(), mCppcheck.getAnalyzedTokens() - tokens);
         processedsize += i->size();
         ++c;
         if (!mSettings.quiet)
@@ -61,12 +78,23 @@ unsigned int SingleExecutor::check()
     // filesettings
     // check all files of the project
     for (const FileSettings &fs : mFileSettings) {
+        const std::size_t tokens = mCppcheck.getAnalyzedTokens();
+        if (mProgressStream)
+            mProgressStream->startFile(0, fs.filename() + ' ' + fs.cfg);
         result += mCppcheck.check(fs);
+        if (mProgressStream)
+            mProgressStream->finishFile(0, 0, mCppcheck.getAnalyzedTokens() - tokens);
         ++c;
         if (!mSettings.quiet)
             reportStatus(c, mFileSettings.size(), c, mFileSettings.size());
     }
 
+    if (mProgressStream) {
+        if (mTimerResults)
+            mTimerResults->setPhaseListener(nullptr);
+        mProgressStream->finish();
+    }
+
     // TODO: show time after the whole program analysis
     // TODO: CppCheckExecutor::check_internal() is also invoking the whole program analysis - is it run twice?
     if (mCppcheck.analyseWholeProgram())
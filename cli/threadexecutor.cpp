@@ -24,11 +24,13 @@
 #include "cppcheck.h"
 #include "errorlogger.h"
 #include "filesettings.h"
+#include "progressstream.h"
 #include "settings.h"
 #include "suppressions.h"
 #include "timer.h"
 
 #include <cassert>
+#include <chrono>
 #include <cstdlib>
 #include <future>
 #include <iostream>
@@ -119,7 +121,7 @@ public:
         return false;
     }
 
-    unsigned int check(const FileWithDetails *file, const FileSettings *fs) {
+    unsigned int check(const FileWithDetails *file, const FileSettings *fs, std::size_t &tokens) {
         CppCheck fileChecker(mSettings, mSuppressions, mLogForwarder, mTimerResults, false, mExecuteCommand);
 
         unsigned int result;
@@ -130,6 +132,7 @@ public:
             // Read file from a file
             result = fileChecker.check(*file);
         }
+        tokens = fileChecker.getAnalyzedTokens();
         for (const auto& suppr : mSuppressions.nomsg.getSuppressions()) {
             // need to transfer all inline suppressions because these are used later on
             if (suppr.isInline) {
@@ -178,16 +181,28 @@ private:
     SyncLogForwarder mLogForwarder;
 };
 
-static unsigned int STDCALL threadProc(ThreadData *data)
+// the worker which the current thread is reported as in the progress stream
+static thread_local std::size_t progressWorker;
+
+static unsigned int STDCALL threadProc(ThreadData *data, ProgressStream *progressStream, std::size_t worker)
 {
     unsigned int result = 0;
 
     const FileWithDetails *file;
     const FileSettings *fs;
     std::size_t fileSize;
+    std::size_t tokens = 0;
+
+    progressWorker = worker;
 
     while (data->next(file, fs, fileSize)) {
-        result += data->check(file, fs);
+        if (progressStream)
+            progressStream->startFile(worker, fs ? (fs->filename() + ' ' + fs->cfg) : file->path());
+
+        result += data->check(file, fs, tokens);
+
+        if (progressStream)
+            progressStream->finishFile(worker, fileSize, tokens);
 
         data->status(fileSize);
     }
@@ -202,9 +217,22 @@ unsigned int ThreadExecutor::check()
 
     ThreadData data(*this, mErrorLogger, mTimerResults, mSettings, mSuppressions, mFiles, mFileSettings, mExecuteCommand);
 
+    if (mProgressStream) {
+        const std::size_t totalfilesize = std::accumulate(mFiles.cbegin(), mFiles.cend(), std::size_t(0), [](std::size_t v, const FileWithDetails& p) {
+            return v + p.size();
+        });
+        mProgressStream->start("thread", mSettings.jobs, mFiles.size() + mFileSettings.size(), totalfilesize);
+        if (mTimerResults) {
+            ProgressStream *progressStream = mProgressStream;
+            mTimerResults->setPhaseListener([progressStream](const std::string& phase) {
+                progressStream->setPhase(progressWorker, phase);
+            });
+        }
+    }
+
     for (unsigned int i = 0; i < mSettings.jobs; ++i) {
         try {
-            threadFutures.emplace_back(std::async(std::launch::async, &threadProc, &data));
+            threadFutures.emplace_back(std::async(std::launch::async, &threadProc, &data, mProgressStream, std::size_t(i)));
         }
         catch (const std::system_error &e) {
             std::cerr << "#### ThreadExecutor::check exception :" << e.what() << std::endl;
@@ -212,10 +240,21 @@ unsigned int ThreadExecutor::check()
         }
     }
 
-    unsigned int result = std::accumulate(threadFutures.begin(), threadFutures.end(), 0U, [](unsigned int v, std::future<unsigned int>& f) {
+    unsigned int result = std::accumulate(threadFutures.begin(), threadFutures.end(), 0U, [this](unsigned int v, std::future<unsigned int>& f) {
+        // keep the progress stream going while a single file takes long
+        if (mProgressStream) {
+            while (f.wait_for(std::chrono::seconds(1)) != std::future_status::ready)
+                mProgressStream->poll();
+        }
         return v + f.get();
     });
 
+    if (mProgressStream) {
+        if (mTimerResults)
+            mTimerResults->setPhaseListener(nullptr);
+        mProgressStream->finish();
+    }
+
     return result;
 }
 
@@ -50,6 +50,10 @@ if(ENABLE_CHECK_INTERNAL)
     add_definitions(-DCHECK_INTERNAL)
 endif()
 
+if(ENABLE_MATCH_PROFILING)
+    add_definitions(-DCPPCHECK_MATCH_PROFILING)
+endif()
+
 if(DISALLOW_THREAD_EXECUTOR)
     add_definitions(-DDISALLOW_THREAD_EXECUTOR)
 endif()
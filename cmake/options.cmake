@@ -71,8 +71,13 @@ endif()
 option(BUILD_TESTS          "Build tests"                                                   OFF)
 option(REGISTER_TESTS       "Register tests in CTest"                                       ON)
 option(ENABLE_CHECK_INTERNAL "Enable internal checks"                                       OFF)
+option(ENABLE_MATCH_PROFILING "Profile the Token::Match() call sites and write a report at exit" OFF)
+if(ENABLE_MATCH_PROFILING AND NOT USE_MATCHCOMPILER_OPT STREQUAL "Off")
+    message(FATAL_ERROR "ENABLE_MATCH_PROFILING requires USE_MATCHCOMPILER to be disabled")
+endif()
 option(DISABLE_DMAKE        "Disable run-dmake dependencies"                                OFF)
 option(BUILD_MANPAGE        "Enable man target to build manpage"                            OFF)
+option(BUILD_BENCHMARKS     "Build the micro-benchmarks"                                    OFF)
 
 option(BUILD_CLI            "Build the CLI application"                                     ON)
 if(NOT BUILD_CLI AND BUILD_TESTING)
@@ -125,6 +130,7 @@ option(NO_UNIX_BACKTRACE_SUPPORT "Disable usage of Unix Backtrace support"
 option(NO_WINDOWS_SEH       "Disable usage of Windows SEH"                                  OFF)
 
 option(ENABLE_CSA_ALPHA     "Enable Clang Static Analyzer alpha checkers for run-clang-tidy-csa target"  OFF)
+set(BENCHMARKS_BASELINE "" CACHE FILEPATH "Results of a previous run to compare the run-benchmarks target against")
 
 # TODO: disable by default like make build?
 option(FILESDIR "Hard-coded directory for files to load from"                               OFF)
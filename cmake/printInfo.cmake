@@ -60,8 +60,10 @@ if(BUILD_TESTING)
     message(STATUS "REGISTER_TESTS =        ${REGISTER_TESTS}")
 endif()
 message(STATUS "ENABLE_CHECK_INTERNAL = ${ENABLE_CHECK_INTERNAL}")
+message(STATUS "ENABLE_MATCH_PROFILING = ${ENABLE_MATCH_PROFILING}")
 message(STATUS "DISABLE_DMAKE =         ${DISABLE_DMAKE}")
 message(STATUS "BUILD_MANPAGE =         ${BUILD_MANPAGE}")
+message(STATUS "BUILD_BENCHMARKS =      ${BUILD_BENCHMARKS}")
 message(STATUS)
 message(STATUS "BUILD_CLI =             ${BUILD_CLI}")
 message(STATUS)
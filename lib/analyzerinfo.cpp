@@ -23,9 +23,12 @@
 #include "path.h"
 #include "utils.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstring>
 #include <exception>
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <sstream>
@@ -168,6 +171,8 @@ bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::st
 
     const std::string analyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(buildDir,sourcefile,cfg,fsFileId);
 
+    // the timings of the previous runs are kept
+    std::vector<Timings> previousTimings;
     {
         tinyxml2::XMLDocument analyzerInfoDoc;
         const tinyxml2::XMLError xmlError = analyzerInfoDoc.LoadFile(analyzerInfoFile.c_str());
@@ -181,6 +186,9 @@ bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::st
             if (debug) {
                 std::cout << "discarding cached result from '" << analyzerInfoFile << "' for '" << sourcefile << "' - " << err << std::endl;
             }
+            const tinyxml2::XMLElement * const rootNode = analyzerInfoDoc.FirstChildElement();
+            for (const tinyxml2::XMLElement *e = rootNode ? rootNode->FirstChildElement("timings") : nullptr; e; e = e->NextSiblingElement("timings"))
+                previousTimings.push_back(Timings::fromXML(e));
         }
         else if (xmlError != tinyxml2::XML_ERROR_FILE_NOT_FOUND) {
             if (debug)
@@ -195,6 +203,10 @@ bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::st
         throw std::runtime_error("failed to open '" + analyzerInfoFile + "'");
     mOutputStream << "<?xml version=\"1.0\"?>\n";
     mOutputStream << "<analyzerinfo hash=\"" << hash << "\">\n";
+    // leave room for the timings of the current run
+    const std::size_t skip = previousTimings.size() >= maxTimings ? previousTimings.size() - maxTimings + 1 : 0;
+    for (std::size_t i = skip; i < previousTimings.size(); ++i)
+        mOutputStream << previousTimings[i].toXML();
 
     return true;
 }
@@ -211,6 +223,164 @@ void AnalyzerInformation::setFileInfo(const std::string &check, const std::strin
         mOutputStream << "  <FileInfo check=\"" << check << "\">\n" << fileInfo << "  </FileInfo>\n";
 }
 
+void AnalyzerInformation::setTimings(const Timings& timings)
+{
+    if (mOutputStream.is_open())
+        mOutputStream << timings.toXML();
+}
+
+std::size_t AnalyzerInformation::Timings::tokens() const
+{
+    std::size_t tokens = 0;
+    for (const Config& config : configs)
+        tokens += config.tokens;
+    return tokens;
+}
+
+std::map<std::string, double> AnalyzerInformation::Timings::phases() const
+{
+    std::map<std::string, double> phases;
+    for (const Config& config : configs) {
+        for (const auto& phase : config.phases)
+            phases[phase.first] += phase.second;
+    }
+    return phases;
+}
+
+std::string AnalyzerInformation::Timings::toXML() const
+{
+    std::ostringstream ostr;
+    ostr << "  <timings run=\"" << run << "\" time=\"" << time << "\">\n";
+    for (const Config& config : configs) {
+        ostr << "    <config name=\"" << ErrorLogger::toxml(config.name) << "\" time=\"" << config.time << "\" tokens=\"" << config.tokens << "\">\n";
+        for (const auto& phase : config.phases)
+            ostr << "      <phase name=\"" << ErrorLogger::toxml(phase.first) << "\" time=\"" << phase.second << "\"/>\n";
+        ostr << "    </config>\n";
+    }
+    ostr << "  </timings>\n";
+    return ostr.str();
+}
+
+AnalyzerInformation::Timings AnalyzerInformation::Timings::fromXML(const tinyxml2::XMLElement* e)
+{
+    Timings timings;
+    timings.run = e->Int64Attribute("run");
+    timings.time = e->DoubleAttribute("time");
+    for (const tinyxml2::XMLElement *c = e->FirstChildElement("config"); c; c = c->NextSiblingElement("config")) {
+        Config config;
+        const char * const name = c->Attribute("name");
+        if (name)
+            config.name = name;
+        config.time = c->DoubleAttribute("time");
+        config.tokens = c->Unsigned64Attribute("tokens");
+        for (const tinyxml2::XMLElement *p = c->FirstChildElement("phase"); p; p = p->NextSiblingElement("phase")) {
+            const char * const phase = p->Attribute("name");
+            if (phase)
+                config.phases[phase] += p->DoubleAttribute("time");
+        }
+        timings.configs.push_back(std::move(config));
+    }
+    return timings;
+}
+
+std::string AnalyzerInformation::readTimings(const std::string& buildDir, std::vector<FileTimings>& timings)
+{
+    const std::string filesTxt(buildDir + "/files.txt");
+    std::ifstream fin(filesTxt.c_str());
+    std::string filesTxtLine;
+    while (std::getline(fin, filesTxtLine)) {
+        FileTimings fileTimings;
+        if (!fileTimings.info.parse(filesTxtLine))
+            return "failed to parse '" + filesTxtLine + "' from '" + filesTxt + "'";
+
+        const std::string xmlfile = buildDir + '/' + fileTimings.info.afile;
+
+        tinyxml2::XMLDocument doc;
+        const tinyxml2::XMLError error = doc.LoadFile(xmlfile.c_str());
+        // the file has not been analyzed
+        if (error == tinyxml2::XML_ERROR_FILE_NOT_FOUND)
+            continue;
+        if (error != tinyxml2::XML_SUCCESS)
+            return "failed to load '" + xmlfile + "' from '" + filesTxt + "'";
+
+        const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement("analyzerinfo");
+        if (rootNode == nullptr)
+            return "no root node found in '" + xmlfile + "' from '" + filesTxt + "'";
+
+        for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement("timings"); e; e = e->NextSiblingElement("timings"))
+            fileTimings.runs.push_back(Timings::fromXML(e));
+        if (!fileTimings.runs.empty())
+            timings.push_back(std::move(fileTimings));
+    }
+    return "";
+}
+
+static std::string changeToString(double previous, double current)
+{
+    if (previous <= 0)
+        return "";
+    const long change = std::lround((current - previous) * 100.0 / previous);
+    return std::string(" (") + (change >= 0 ? "+" : "") + std::to_string(change) + "%)";
+}
+
+std::string AnalyzerInformation::reportSlowest(std::vector<FileTimings> timings, std::size_t count)
+{
+    if (timings.empty())
+        return "No analysis timings have been recorded.\n";
+
+    std::stable_sort(timings.begin(), timings.end(), [](const FileTimings& lhs, const FileTimings& rhs) {
+        return lhs.runs.back().time > rhs.runs.back().time;
+    });
+    if (timings.size() > count)
+        timings.resize(count);
+
+    std::ostringstream ostr;
+    ostr << std::fixed << std::setprecision(3);
+    ostr << "Slowest files:\n";
+    for (const FileTimings& fileTimings : timings) {
+        const Timings& last = fileTimings.runs.back();
+        const Timings* const previous = fileTimings.runs.size() > 1 ? &fileTimings.runs[fileTimings.runs.size() - 2] : nullptr;
+
+        ostr << fileTimings.info.sourceFile;
+        if (!fileTimings.info.cfg.empty())
+            ostr << " (" << fileTimings.info.cfg << ")";
+        ostr << ": " << last.time << "s, " << last.tokens() << " tokens";
+        if (previous)
+            ostr << " - previous run: " << previous->time << "s" << changeToString(previous->time, last.time) << ", " << previous->tokens() << " tokens";
+        ostr << '\n';
+
+        if (fileTimings.runs.size() > 1) {
+            ostr << "    history:";
+            for (const Timings& run : fileTimings.runs)
+                ostr << ' ' << run.time << 's';
+            ostr << '\n';
+        }
+
+        // the slowest phases of the last run
+        const std::map<std::string, double> phases = last.phases();
+        std::vector<std::pair<std::string, double>> slowest(phases.cbegin(), phases.cend());
+        std::stable_sort(slowest.begin(), slowest.end(), [](const std::pair<std::string, double>& lhs, const std::pair<std::string, double>& rhs) {
+            return lhs.second > rhs.second;
+        });
+        if (slowest.size() > 3)
+            slowest.resize(3);
+        const std::map<std::string, double> previousPhases = previous ? previous->phases() : std::map<std::string, double>{};
+        for (const auto& phase : slowest) {
+            ostr << "    " << phase.first << ": " << phase.second << 's';
+            const auto it = previousPhases.find(phase.first);
+            if (it != previousPhases.cend())
+                ostr << changeToString(it->second, phase.second);
+            ostr << '\n';
+        }
+
+        if (last.configs.size() > 1) {
+            for (const Timings::Config& config : last.configs)
+                ostr << "    configuration '" << config.name << "': " << config.time << "s, " << config.tokens << " tokens\n";
+        }
+    }
+    return ostr.str();
+}
+
 // TODO: report detailed errors?
 bool AnalyzerInformation::Info::parse(const std::string& filesTxtLine) {
     const std::string::size_type sep1 = filesTxtLine.find(sep);
@@ -24,10 +24,13 @@
 #include "config.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <list>
+#include <map>
 #include <string>
+#include <vector>
 
 class ErrorMessage;
 struct FileSettings;
@@ -47,6 +50,7 @@ namespace tinyxml2 {
  * - checksum
  * - error messages
  * - whole program analysis data
+ * - timings of the last analysis runs
  *
  * The information can be used for various purposes. It allows:
  * - 'make' - only analyze TUs that are changed and generate full report
@@ -84,6 +88,58 @@ public:
 
     static std::string processFilesTxt(const std::string& buildDir, const std::function<void(const char* checkattr, const tinyxml2::XMLElement* e, const Info& filesTxtInfo)>& handler, bool debug = false);
 
+    /** @brief Timings of a single analysis run of a file */
+    struct CPPCHECKLIB Timings {
+        struct Config {
+            std::string name;
+            /** duration in seconds */
+            double time{};
+            std::size_t tokens{};
+            /** duration of the slowest phases in seconds */
+            std::map<std::string, double> phases;
+        };
+
+        /** @brief The amount of the slowest phases which are kept for each configuration */
+        static const std::size_t maxPhases = 10;
+
+        /** start of the analysis as seconds since the epoch */
+        std::int64_t run{};
+        /** duration in seconds */
+        double time{};
+        std::vector<Config> configs;
+
+        std::size_t tokens() const;
+        /** @brief duration of each phase in all configurations in seconds */
+        std::map<std::string, double> phases() const;
+
+        std::string toXML() const;
+        static Timings fromXML(const tinyxml2::XMLElement* e);
+    };
+
+    /** @brief The amount of analysis runs of which the timings are kept */
+    static const std::size_t maxTimings = 10;
+
+    /** @brief Add the timings of the current analysis. The timings of the previous runs are kept. */
+    void setTimings(const Timings& timings);
+
+    /** @brief The timings of the last analysis runs of a file */
+    struct CPPCHECKLIB FileTimings {
+        Info info;
+        /** the oldest run first */
+        std::vector<Timings> runs;
+    };
+
+    /** @brief Read the timings of all analyzed files */
+    static std::string readTimings(const std::string& buildDir, std::vector<FileTimings>& timings);
+
+    /**
+     * @brief Report the files which took the longest to analyze in their last run
+     * and how their analysis time changed compared to the previous runs.
+     * @param timings the timings of the files
+     * @param count   the amount of files to report
+     */
+    static std::string reportSlowest(std::vector<FileTimings> timings, std::size_t count);
+
 protected:
     static std::string getFilesTxt(const std::list<std::string> &sourcefiles, const std::list<FileSettings> &fileSettings);
 
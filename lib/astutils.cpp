@@ -108,17 +108,23 @@ static int getArgumentPos(const Token* ftok, const Token* tokToFind){
 }
 
 template<class T, class OuputIterator, REQUIRES("T must be a Token class", std::is_convertible<T*, const Token*> )>
-static void astFlattenCopy(T* tok, const char* op, OuputIterator out, int depth = 100)
-{
-    --depth;
-    if (!tok || depth < 0)
-        return;
-    if (strcmp(tok->str().c_str(), op) == 0) {
-        astFlattenCopy(tok->astOperand1(), op, out, depth);
-        astFlattenCopy(tok->astOperand2(), op, out, depth);
-    } else {
-        *out = tok;
-        ++out;
+static void astFlattenCopy(T* tok, const char* op, OuputIterator out)
+{
+    // use an explicit stack so long operator chains (i.e. huge initializer lists) are neither truncated nor overflow the stack
+    SmallVector<T*, 8 + 1> tokens;
+    tokens.push_back(tok);
+    while (!tokens.empty()) {
+        tok = tokens.back();
+        tokens.pop_back();
+        if (!tok)
+            continue;
+        if (strcmp(tok->str().c_str(), op) == 0) {
+            tokens.push_back(tok->astOperand2());
+            tokens.push_back(tok->astOperand1());
+        } else {
+            *out = tok;
+            ++out;
+        }
     }
 }
 
@@ -803,7 +803,7 @@ bool CheckClass::isBaseClassMutableMemberFunc(const Token *tok, const Scope *sco
 
         // Check if base class exists in database
         if (derivedFrom && derivedFrom->classScope) {
-            const std::list<Function>& functionList = derivedFrom->classScope->functionList;
+            const auto& functionList = derivedFrom->classScope->functionList;
 
             if (std::any_of(functionList.cbegin(), functionList.cend(), [&](const Function& func) {
                 return func.tokenDef->str() == tok->str() && !func.isStatic() && !func.isConst();
@@ -657,7 +657,7 @@ void CheckOther::checkRedundantAssignment()
                     // If there is a custom assignment operator => this is inconclusive
                     if (tok->astOperand1()->valueType()->typeScope) {
                         const std::string op = "operator" + tok->str();
-                        const std::list<Function>& fList = tok->astOperand1()->valueType()->typeScope->functionList;
+                        const auto& fList = tok->astOperand1()->valueType()->typeScope->functionList;
                         inconclusive = std::any_of(fList.cbegin(), fList.cend(), [&](const Function& f) {
                             return f.name() == op;
                         });
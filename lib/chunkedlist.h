@@ -0,0 +1,237 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2025 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef chunkedlistH
+#define chunkedlistH
+//---------------------------------------------------------------------------
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Sequence container that stores its elements in chunks.
+ *
+ * The first chunk holds N elements and each further chunk is twice as large
+ * as the previous one, so a small list does not reserve much memory and a
+ * large one only needs a few chunks. Elements are only added and removed at
+ * the end and are never moved, so pointers and references to them stay valid
+ * like in a std::list. Iterators are index based and also stay valid when
+ * elements are added.
+ */
+template<class T, std::size_t N = 32>
+class ChunkedList {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "chunk size must be a power of two");
+
+    static constexpr std::size_t log2(std::size_t n) {
+        return n <= 1 ? 0 : 1 + log2(n / 2);
+    }
+
+    /** index of the highest bit which is set - n must not be 0 */
+    static std::size_t highestBit(std::size_t n) {
+#if defined(__GNUC__)
+        return (sizeof(unsigned long long) * 8) - 1 - __builtin_clzll(n);
+#elif defined(_MSC_VER) && defined(_WIN64)
+        unsigned long index;
+        _BitScanReverse64(&index, n);
+        return index;
+#elif defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse(&index, n);
+        return index;
+#else
+        std::size_t index = 0;
+        while (n >>= 1)
+            ++index;
+        return index;
+#endif
+    }
+
+    template<class Container, class Value>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator() = default;
+        Iterator(Container* container, std::size_t index) : mContainer(container), mIndex(index) {}
+
+        template<class C, class V>
+        // cppcheck-suppress noExplicitConstructor
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        Iterator(const Iterator<C, V>& other) : mContainer(other.mContainer), mIndex(other.mIndex) {}
+
+        reference operator*() const {
+            return (*mContainer)[mIndex];
+        }
+        pointer operator->() const {
+            return &(*mContainer)[mIndex];
+        }
+        Iterator& operator++() {
+            ++mIndex;
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator ret = *this;
+            ++mIndex;
+            return ret;
+        }
+        Iterator& operator--() {
+            --mIndex;
+            return *this;
+        }
+        Iterator operator--(int) {
+            Iterator ret = *this;
+            --mIndex;
+            return ret;
+        }
+        template<class C, class V>
+        bool operator==(const Iterator<C, V>& other) const {
+            return mIndex == other.mIndex;
+        }
+        template<class C, class V>
+        bool operator!=(const Iterator<C, V>& other) const {
+            return mIndex != other.mIndex;
+        }
+
+    private:
+        template<class, class>
+        friend class Iterator;
+
+        Container* mContainer{};
+        std::size_t mIndex{};
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<ChunkedList, T>;
+    using const_iterator = Iterator<const ChunkedList, const T>;
+
+    ChunkedList() = default;
+    ChunkedList(const ChunkedList&) = delete;
+    ChunkedList& operator=(const ChunkedList&) = delete;
+
+    ~ChunkedList() {
+        clear();
+        for (T* chunk : mChunks)
+            ::operator delete(chunk);
+    }
+
+    std::size_t size() const {
+        return mSize;
+    }
+    /** amount of elements which fit in the allocated chunks */
+    std::size_t capacity() const {
+        return N * ((std::size_t{1} << mChunks.size()) - 1);
+    }
+    bool empty() const {
+        return mSize == 0;
+    }
+
+    // chunk k starts at the index N * (2^k - 1) so the chunk is found by the highest bit of i + N
+    T& operator[](std::size_t i) {
+        const std::size_t bit = highestBit(i + N);
+        return mChunks[bit - log2(N)][i + N - (std::size_t{1} << bit)];
+    }
+    const T& operator[](std::size_t i) const {
+        const std::size_t bit = highestBit(i + N);
+        return mChunks[bit - log2(N)][i + N - (std::size_t{1} << bit)];
+    }
+
+    T& front() {
+        return (*this)[0];
+    }
+    const T& front() const {
+        return (*this)[0];
+    }
+    T& back() {
+        return (*this)[mSize - 1];
+    }
+    const T& back() const {
+        return (*this)[mSize - 1];
+    }
+
+    iterator begin() {
+        return iterator(this, 0);
+    }
+    iterator end() {
+        return iterator(this, mSize);
+    }
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const {
+        return const_iterator(this, mSize);
+    }
+    const_iterator cbegin() const {
+        return begin();
+    }
+    const_iterator cend() const {
+        return end();
+    }
+
+    template<class ... Args>
+    T& emplace_back(Args&&... args) {
+        if (mSize == capacity())
+            mChunks.push_back(static_cast<T*>(::operator new((N << mChunks.size()) * sizeof(T))));
+        T* const p = new (&(*this)[mSize]) T(std::forward<Args>(args)...);
+        ++mSize;
+        return *p;
+    }
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    void pop_back() {
+        --mSize;
+        (*this)[mSize].~T();
+    }
+
+    void clear() {
+        while (mSize > 0)
+            pop_back();
+    }
+
+private:
+    /** Uninitialized storage for N * 2^k elements in chunk k. Chunks are kept when elements are removed. */
+    std::vector<T*> mChunks;
+    std::size_t mSize{};
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // chunkedlistH
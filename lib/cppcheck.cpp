@@ -51,6 +51,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstdio>
 #include <cstdint>
 #include <cstring>
@@ -875,6 +876,9 @@ std::size_t CppCheck::calculateHash(const Preprocessor& preprocessor, const std:
         toolinfo << a.args;
     }
     toolinfo << mSettings.premiumArgs;
+    // the results depend on the return values of the functions in the other files
+    for (const auto &r : mSettings.summaryReturnValue)
+        toolinfo << r.first << ':' << r.second.value << ':' << r.second.argCount << ' ';
     // TODO: do we need to add more options?
     mSuppressions.nomsg.dump(toolinfo, filePath);
     return preprocessor.calculateHash(toolinfo.str());
@@ -911,6 +915,90 @@ void CppCheck::checkPlistOutput(const FileWithDetails& file, const std::vector<s
     }
 }
 
+/** Add the amount of the main objects of the simplified code to the memory measurements */
+static void addObjects(TimerResults& timerResults, const Tokenizer& tokenizer)
+{
+    timerResults.addObjects("Token", tokenizer.list.getTokenCount(), sizeof(Token));
+    timerResults.addObjects("ValueFlow::Value", tokenizer.list.getValueCount(), sizeof(ValueFlow::Value));
+
+    const SymbolDatabase* symbolDatabase = tokenizer.getSymbolDatabase();
+    if (!symbolDatabase)
+        return;
+    std::size_t variables = 0;
+    std::size_t functions = 0;
+    for (const Scope& scope : symbolDatabase->scopeList) {
+        variables += scope.varlist.size();
+        functions += scope.functionList.size();
+    }
+    timerResults.addObjects("Scope", symbolDatabase->scopeList.size(), sizeof(Scope));
+    timerResults.addObjects("Variable", variables, sizeof(Variable));
+    timerResults.addObjects("Function", functions, sizeof(Function));
+}
+
+namespace {
+    /** records the timings of a configuration when it goes out of scope - skipped configurations are not recorded */
+    class ConfigTimings {
+    public:
+        ConfigTimings(AnalyzerInformation::Timings* timings, TimerResults* timerResults, std::string name)
+            : mTimings(timings)
+            , mTimerResults(timerResults)
+        {
+            if (!mTimings)
+                return;
+            mConfig.name = std::move(name);
+            if (mTimerResults)
+                mStartPhases = mTimerResults->getThreadResults();
+            mStart = Timer::Clock::now();
+        }
+
+        ~ConfigTimings() {
+            if (!mTimings || !mSimplified)
+                return;
+            mConfig.time = toSeconds(Timer::Clock::now() - mStart);
+            if (mTimerResults) {
+                // the phases which have been measured by this thread since the start
+                std::vector<std::pair<std::string, std::chrono::nanoseconds>> phases;
+                for (const auto& phase : mTimerResults->getThreadResults()) {
+                    const auto it = mStartPhases.find(phase.first);
+                    const std::chrono::nanoseconds duration = it == mStartPhases.cend() ? phase.second : phase.second - it->second;
+                    if (duration.count() > 0)
+                        phases.emplace_back(phase.first, duration);
+                }
+                // only keep the slowest ones to limit the size of the analyzer information
+                std::sort(phases.begin(), phases.end(), [](const std::pair<std::string, std::chrono::nanoseconds>& lhs, const std::pair<std::string, std::chrono::nanoseconds>& rhs) {
+                    return lhs.second > rhs.second;
+                });
+                if (phases.size() > AnalyzerInformation::Timings::maxPhases)
+                    phases.resize(AnalyzerInformation::Timings::maxPhases);
+                for (const auto& phase : phases)
+                    mConfig.phases[phase.first] = toSeconds(phase.second);
+            }
+            mTimings->configs.push_back(std::move(mConfig));
+        }
+
+        ConfigTimings(const ConfigTimings&) = delete;
+        ConfigTimings& operator=(const ConfigTimings&) = delete;
+
+        /** the configuration has been simplified */
+        void setTokens(std::size_t tokens) {
+            mConfig.tokens = tokens;
+            mSimplified = true;
+        }
+
+        static double toSeconds(std::chrono::nanoseconds duration) {
+            return std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+        }
+
+    private:
+        AnalyzerInformation::Timings* const mTimings;
+        TimerResults* const mTimerResults;
+        AnalyzerInformation::Timings::Config mConfig;
+        std::map<std::string, std::chrono::nanoseconds> mStartPhases;
+        Timer::TimePoint mStart;
+        bool mSimplified{};
+    };
+}
+
 unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::string &cfgname, const CreateTokenListFn& createTokenList)
 {
     // TODO: move to constructor when CppCheck no longer owns the settings
@@ -926,7 +1014,10 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
 
     std::unique_ptr<OneShotTimer> checkTimeTimer;
     if (mSettings.showtime == Settings::ShowTime::FILE || mSettings.showtime == Settings::ShowTime::FILE_TOTAL || mSettings.showtime == Settings::ShowTime::TOP5_FILE)
-        checkTimeTimer.reset(new OneShotTimer("Check time: " + file.spath()));
+        checkTimeTimer.reset(new OneShotTimer("Check time: " + file.spath(), mSettings.showcounters));
+
+    TimerResults::setTraceContext(file.spath(), cfgname);
+    const TraceSpan traceSpan("CppCheck::checkFile", mTimerResults);
 
     if (!mSettings.quiet) {
         std::string fixedpath = Path::toNativeSeparators(file.spath());
@@ -952,6 +1043,10 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
     mLogger->closePlist();
 
     std::unique_ptr<AnalyzerInformation> analyzerInformation;
+    // the timings which are stored in the analyzer information
+    AnalyzerInformation::Timings timings;
+    timings.run = std::time(nullptr);
+    const Timer::TimePoint startTime = Timer::Clock::now();
 
     try {
         if (mSettings.library.markupFile(file.spath())) {
@@ -993,6 +1088,13 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
         std::vector<std::string> files;
         simplecpp::TokenList tokens1 = createTokenList(files, &outputList);
 
+        if (mSettings.showmemory && mTimerResults) {
+            std::size_t count = 0;
+            for (const simplecpp::Token* tok = tokens1.cfront(); tok; tok = tok->next)
+                ++count;
+            mTimerResults->addObjects("simplecpp::Token", count, sizeof(simplecpp::Token));
+        }
+
         Preprocessor preprocessor(tokens1, mSettings, mErrorLogger, file.lang());
 
         if (preprocessor.reportOutput(outputList, true))
@@ -1046,7 +1148,8 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
         // Get configurations..
         std::set<std::string> configurations;
         if (maxConfigs > 1) {
-            Timer::run("Preprocessor::getConfigs", mTimerResults, [&]() {
+            static const TimerName getConfigsTimer("Preprocessor::getConfigs");
+            Timer::run(getConfigsTimer, mTimerResults, [&]() {
                 configurations = preprocessor.getConfigs();
             });
         } else {
@@ -1093,6 +1196,7 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
         }
 
         std::set<unsigned long long> hashes;
+        std::set<unsigned long long> rawHashes;
         int checkCount = 0;
         bool hasValidConfig = false;
         std::list<std::string> configurationError;
@@ -1128,10 +1232,13 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             } else {
                 currentConfig = currCfg;
             }
+            TimerResults::setTraceContext(file.spath(), currentConfig);
+            ConfigTimings configTimings(analyzerInformation ? &timings : nullptr, mTimerResults, currentConfig);
 
             if (mSettings.preprocessOnly) {
                 std::string codeWithoutCfg;
-                Timer::run("Preprocessor::getcode", mTimerResults, [&]() {
+                static const TimerName getcodeTimer("Preprocessor::getcode");
+                Timer::run(getcodeTimer, mTimerResults, [&]() {
                     codeWithoutCfg = preprocessor.getcode(currentConfig, files, true);
                 });
 
@@ -1155,7 +1262,8 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             {
                 bool skipCfg = false;
                 // Create tokens, skip rest of iteration if failed
-                Timer::run("Tokenizer::createTokens", mTimerResults, [&]() {
+                static const TimerName createTokensTimer("Tokenizer::createTokens");
+                Timer::run(createTokensTimer, mTimerResults, [&]() {
                     simplecpp::OutputList outputList_cfg;
                     simplecpp::TokenList tokensP = preprocessor.preprocess(currentConfig, files, outputList_cfg);
                     const simplecpp::Output* o = preprocessor.handleErrors(outputList_cfg);
@@ -1200,6 +1308,19 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
                 if (mSettings.checkConfiguration)
                     continue;
 
+                // Skip if we already checked the same preprocessed token list, it simplifies to the same tokens.
+                // The dump output and inline suppressions need the simplified token list of each configuration.
+                std::size_t rawHash = 0;
+                const bool useRawHash = maxConfigs > 1 && !fdump.is_open() && !mSettings.inlineSuppressions;
+                if (useRawHash) {
+                    rawHash = tokenizer.list.calculateHash();
+                    if (rawHashes.find(rawHash) != rawHashes.end()) {
+                        if (mSettings.debugwarnings)
+                            purgedConfigurationMessage(file.spath(), currentConfig);
+                        continue;
+                    }
+                }
+
 #ifdef HAVE_RULES
                 // Execute rules for "raw" code
                 executeRules("raw", tokenizer.list);
@@ -1208,6 +1329,11 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
                 // Simplify tokens into normal form, skip rest of iteration if failed
                 if (!tokenizer.simplifyTokens1(currentConfig, file.fsFileId()))
                     continue;
+                mAnalyzedTokens += tokenizer.list.getTokenCount();
+                configTimings.setTokens(tokenizer.list.getTokenCount());
+
+                if (useRawHash)
+                    rawHashes.insert(rawHash);
 
                 // dump xml if --dump
                 if ((mSettings.dump || !mSettings.addons.empty()) && fdump.is_open()) {
@@ -1240,6 +1366,9 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
 
                 // Check normal tokens
                 checkNormalTokens(tokenizer, analyzerInformation.get(), currentConfig);
+
+                if (mSettings.showmemory && mTimerResults)
+                    addObjects(*mTimerResults, tokenizer);
             } catch (const InternalError &e) {
                 ErrorMessage errmsg = ErrorMessage::fromInternalError(e, &tokenizer.list, file.spath());
                 mErrorLogger.reportErr(errmsg);
@@ -1287,6 +1416,8 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
     }
 
     if (analyzerInformation) {
+        timings.time = ConfigTimings::toSeconds(Timer::Clock::now() - startTime);
+        analyzerInformation->setTimings(timings);
         mLogger->setAnalyzerInfo(nullptr);
         analyzerInformation.reset();
     }
@@ -1299,6 +1430,8 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             mTimerResults->showResults();
         else if (mSettings.showtime == Settings::ShowTime::TOP5_FILE)
             mTimerResults->showResults(5);
+        if (mSettings.showmemory)
+            mTimerResults->showMemory();
     }
 
     return mLogger->exitcode();
@@ -1336,7 +1469,19 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation
     const bool doUnusedFunctionOnly = Settings::unusedFunctionOnly();
 
     if (!doUnusedFunctionOnly) {
-        const std::time_t maxTime = mSettings.checksMaxTime > 0 ? std::time(nullptr) + mSettings.checksMaxTime : 0;
+        const std::time_t startTime = std::time(nullptr);
+        const std::time_t maxTime = mSettings.checksMaxTime > 0 ? startTime + mSettings.checksMaxTime : 0;
+        std::size_t checksDone = 0;
+
+        // the timers of the registered Check classes in the same order
+        static const std::vector<TimerName> runChecksTimers = []() {
+            std::vector<TimerName> timers;
+            timers.reserve(CheckInstances::get().size());
+            for (const Check * const c : CheckInstances::get())
+                timers.emplace_back(c->name() + "::runChecks");
+            return timers;
+        }();
+        auto runChecksTimer = runChecksTimers.cbegin();
 
         // call all "runChecks" in all registered Check classes
         for (Check * const c : CheckInstances::get()) {
@@ -1344,6 +1489,8 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation
                 return;
 
             if (maxTime > 0 && std::time(nullptr) > maxTime) {
+                if (!mSettings.limitsReportFile.empty())
+                    mErrorLogger.reportLimit(tokenizer.list.getSourceFilePath(), "", "checksMaxTime", mSettings.checksMaxTime, checksDone, (std::time(nullptr) - startTime) * 1000);
                 if (mSettings.debugwarnings) {
                     ErrorMessage::FileLocation loc(tokenizer.list.getFiles()[0], 0, 0);
                     ErrorMessage errmsg({std::move(loc)},
@@ -1357,9 +1504,11 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation
                 return;
             }
 
-            Timer::run(c->name() + "::runChecks", mTimerResults, [&]() {
+            Timer::run(*runChecksTimer, mTimerResults, [&]() {
                 c->runChecks(tokenizer, &mErrorLogger);
             });
+            ++runChecksTimer;
+            ++checksDone;
         }
     }
 
@@ -1491,7 +1640,8 @@ void CppCheck::executeAddons(const std::string& dumpFile, const FileWithDetails&
 {
     if (!dumpFile.empty()) {
         std::vector<std::string> f{dumpFile};
-        Timer::run("CppCheck::executeAddons", mTimerResults, [&]() {
+        static const TimerName executeAddonsTimer("CppCheck::executeAddons");
+        Timer::run(executeAddonsTimer, mTimerResults, [&]() {
             executeAddons(f, file.spath());
         });
     }
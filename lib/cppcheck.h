@@ -142,6 +142,11 @@ public:
     /** analyse whole program use .analyzeinfo files or ctuinfo string */
     unsigned int analyseWholeProgram(const std::string &buildDir, const std::list<FileWithDetails> &files, const std::list<FileSettings>& fileSettings, const std::string& ctuInfo);
 
+    /** @brief The amount of simplified tokens of all configurations which have been analyzed by this instance */
+    std::size_t getAnalyzedTokens() const {
+        return mAnalyzedTokens;
+    }
+
 private:
     void purgedConfigurationMessage(const std::string &file, const std::string& configuration);
 
@@ -254,6 +259,8 @@ private:
     ExecuteCmdFn mExecuteCommand;
 
     std::unique_ptr<CheckUnusedFunctions> mUnusedFunctionsCheck;
+
+    std::size_t mAnalyzedTokens{};
 };
 
 /// @}
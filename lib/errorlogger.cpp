@@ -778,6 +778,25 @@ std::string ErrorMessage::FileLocation::stringify(bool addcolumn) const
     return str;
 }
 
+void ErrorLogger::reportLimit(const std::string &file, const std::string &function, const std::string &id, std::int64_t limit, std::int64_t work, std::int64_t time)
+{
+    std::string metric = "<limit fileName=\"" + toxml(file) + "\"";
+    if (!function.empty())
+        metric += " function=\"" + toxml(function) + "\"";
+    metric += " id=\"" + toxml(id) + "\"";
+    metric += " limit=\"" + std::to_string(limit) + "\"";
+    metric += " work=\"" + std::to_string(work) + "\"";
+    if (time >= 0)
+        metric += " time=\"" + std::to_string(time) + "\"";
+    metric += "/>";
+    reportMetric(metric);
+}
+
+bool ErrorLogger::isLimitMetric(const std::string &metric)
+{
+    return startsWith(metric, "<limit ");
+}
+
 std::string ErrorLogger::toxml(const std::string &str)
 {
     std::string xml;
@@ -262,6 +262,23 @@ public:
         (void)value;
     }
 
+    /**
+     * Report that an analysis limit was hit and the analysis was cut short.
+     * The record is reported as metric so it is forwarded like the other metrics.
+     * It starts with the file, the function and the id which identify the limit.
+     *
+     * @param file     analyzed file
+     * @param function function which was analyzed - empty if the limit applies to the whole file
+     * @param id       name of the limit
+     * @param limit    configured value of the limit
+     * @param work     work which was done so far - the unit depends on the limit
+     * @param time     time spent so far in milliseconds - negative if unknown
+     */
+    void reportLimit(const std::string &file, const std::string &function, const std::string &id, std::int64_t limit, std::int64_t work, std::int64_t time = -1);
+
+    /** Is the given metric a record reported by reportLimit() */
+    static bool isLimitMetric(const std::string &metric);
+
     static std::string callStackToString(const std::list<ErrorMessage::FileLocation> &callStack, bool addcolumn = false);
 
     /**
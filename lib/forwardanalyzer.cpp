@@ -33,6 +33,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstdio>
 #include <cstdint>
 #include <functional>
@@ -48,7 +49,10 @@ namespace {
         enum class Progress : std::uint8_t { Continue, Break, Skip };
         ForwardTraversal(const ValuePtr<Analyzer>& analyzer, const TokenList& tokenList, ErrorLogger& errorLogger, const Settings& settings)
             : analyzer(analyzer), tokenList(tokenList), errorLogger(errorLogger), settings(settings)
-        {}
+        {
+            if (!settings.limitsReportFile.empty())
+                startTime = std::chrono::steady_clock::now();
+        }
         ValuePtr<Analyzer> analyzer;
         const TokenList& tokenList;
         ErrorLogger& errorLogger;
@@ -59,6 +63,8 @@ namespace {
         Analyzer::Terminate terminate = Analyzer::Terminate::None;
         std::vector<Token*> loopEnds;
         int branchCount = 0;
+        bool recursionReported{};
+        std::chrono::steady_clock::time_point startTime;
 
         Progress Break(Analyzer::Terminate t = Analyzer::Terminate::None) {
             if ((!analyzeOnly || analyzeTerminate) && t != Analyzer::Terminate::None)
@@ -177,8 +183,13 @@ namespace {
         Progress traverseRecursive(T* tok, const F &f, bool traverseUnknown, unsigned int recursion=0) {
             if (!tok)
                 return Progress::Continue;
-            if (recursion > 10000)
+            if (recursion > 10000) {
+                if (!recursionReported && !settings.limitsReportFile.empty()) {
+                    recursionReported = true;
+                    reportLimit(tok, "forwardRecursion", 10000, recursion);
+                }
                 return Progress::Skip;
+            }
             T* firstOp = tok->astOperand1();
             T* secondOp = tok->astOperand2();
             // Evaluate:
@@ -686,6 +697,8 @@ namespace {
                 } else if (tok->isControlFlowKeyword() && Token::Match(tok, "if|while|for (") &&
                            Token::simpleMatch(tok->linkAt(1), ") {")) {
                     if ((settings.vfOptions.maxForwardBranches > 0) && (++branchCount > settings.vfOptions.maxForwardBranches)) {
+                        if (!settings.limitsReportFile.empty())
+                            reportLimit(tok, "valueFlowMaxForwardBranches", settings.vfOptions.maxForwardBranches, branchCount);
                         // TODO: should be logged on function-level instead of file-level
                         if (settings.severity.isEnabled(Severity::information)) {
                             reportError(Severity::information, "normalCheckLevelMaxBranches", "Limiting analysis of branches. Use --check-level=exhaustive to analyze all branches.");
@@ -879,6 +892,12 @@ namespace {
             errorLogger.reportErr(errmsg);
         }
 
+        void reportLimit(const Token* tok, const std::string& id, std::int64_t limit, std::int64_t work) {
+            const Function* function = Scope::nestedInFunction(tok->scope());
+            const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+            errorLogger.reportLimit(tokenList.getSourceFilePath(), function ? function->name() : "", id, limit, work, elapsed.count());
+        }
+
         static bool isFunctionCall(const Token* tok)
         {
             if (!Token::simpleMatch(tok, "("))
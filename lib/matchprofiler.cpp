@@ -0,0 +1,242 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "matchprofiler.h"
+
+#ifdef CPPCHECK_MATCH_PROFILING
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+    struct Stats {
+        std::uint64_t calls{};
+        std::uint64_t matches{};
+        std::chrono::nanoseconds time{};
+
+        void merge(const Stats& other) {
+            calls += other.calls;
+            matches += other.matches;
+            time += other.time;
+        }
+    };
+
+    /** file, line, column and pattern of a call */
+    using Site = std::tuple<std::string, std::uint_least32_t, std::uint_least32_t, std::string>;
+
+    /** the results of all threads which have finished - the report is written when it is destroyed at exit */
+    class Report {
+    public:
+        Report() = default;
+        Report(const Report&) = delete;
+        Report& operator=(const Report&) = delete;
+
+        ~Report() {
+            if (mTaken)
+                return;
+            const char* const filename = std::getenv("CPPCHECK_MATCH_PROFILE");
+            if (filename && *filename) {
+                std::ofstream fout(filename);
+                write(fout);
+            } else {
+                write(std::cerr);
+            }
+        }
+
+        void merge(const Site& site, const Stats& stats) {
+            std::lock_guard<std::mutex> l(mSync);
+            mStats[site].merge(stats);
+        }
+
+        std::vector<std::string> take() {
+            std::lock_guard<std::mutex> l(mSync);
+            std::vector<std::string> results;
+            results.reserve(mStats.size());
+            for (const auto& entry : mStats) {
+                const Site& site = entry.first;
+                const Stats& stats = entry.second;
+                // the pattern might contain ';' so it is the last field
+                results.push_back(std::get<0>(site) + ';' + std::to_string(std::get<1>(site)) + ';' + std::to_string(std::get<2>(site)) + ';' +
+                                  std::to_string(stats.calls) + ';' + std::to_string(stats.matches) + ';' + std::to_string(stats.time.count()) + ';' +
+                                  std::get<3>(site));
+            }
+            mStats.clear();
+            mTaken = true;
+            return results;
+        }
+
+    private:
+        void write(std::ostream& out) const {
+            std::vector<std::pair<Site, Stats>> data(mStats.cbegin(), mStats.cend());
+            std::sort(data.begin(), data.end(), [](const std::pair<Site, Stats>& lhs, const std::pair<Site, Stats>& rhs) {
+                return lhs.second.time > rhs.second.time;
+            });
+
+            out << "time[ms] calls matches location pattern" << std::endl;
+            for (const auto& d : data) {
+                const Site& site = d.first;
+                const Stats& stats = d.second;
+                out << std::fixed << std::setprecision(3) << (static_cast<double>(stats.time.count()) / 1000000.0)
+                    << ' ' << stats.calls
+                    << ' ' << stats.matches
+                    << ' ' << std::get<0>(site) << ':' << std::get<1>(site) << ':' << std::get<2>(site)
+                    << " \"" << std::get<3>(site) << '"' << std::endl;
+            }
+        }
+
+        std::mutex mSync;
+        std::map<Site, Stats> mStats;
+        /** the results have been taken by another process */
+        bool mTaken{};
+    };
+
+    Report& getReport()
+    {
+        static Report report;
+        return report;
+    }
+
+    /**
+     * The results of a single thread. The call sites are identified by the location
+     * and the address of the pattern which is usually a string literal. The contents
+     * of the pattern are compared as well in case the address has been reused.
+     */
+    class ThreadResults {
+    public:
+        ThreadResults()
+            : mReport(getReport()) // make sure the report is destroyed after the results of the main thread
+        {}
+
+        ThreadResults(const ThreadResults&) = delete;
+        ThreadResults& operator=(const ThreadResults&) = delete;
+
+        ~ThreadResults() {
+            flush();
+        }
+
+        /** add the results to the report */
+        void flush() {
+            for (const auto& entry : mStats) {
+                for (const Entry& e : entry.second)
+                    mReport.merge(Site(std::get<0>(entry.first), std::get<1>(entry.first), std::get<2>(entry.first), e.pattern), e.stats);
+            }
+            mStats.clear();
+        }
+
+        void add(const SourceLocation& location, const char pattern[], bool matched, std::chrono::nanoseconds time) {
+            std::vector<Entry>& entries = mStats[Key(location.file_name(), location.line(), location.column(), pattern)];
+            auto it = std::find_if(entries.begin(), entries.end(), [&](const Entry& e) {
+                return e.pattern == pattern;
+            });
+            if (it == entries.end()) {
+                entries.emplace_back();
+                it = entries.end() - 1;
+                it->pattern = pattern;
+            }
+            ++it->stats.calls;
+            if (matched)
+                ++it->stats.matches;
+            it->stats.time += time;
+        }
+
+    private:
+        using Key = std::tuple<const char*, std::uint_least32_t, std::uint_least32_t, const char*>;
+
+        struct KeyHash {
+            std::size_t operator()(const Key& key) const {
+                std::size_t h = std::hash<const char*>{}(std::get<0>(key));
+                h = h * 31 + std::get<1>(key);
+                h = h * 31 + std::get<2>(key);
+                h = h * 31 + std::hash<const char*>{}(std::get<3>(key));
+                return h;
+            }
+        };
+
+        struct Entry {
+            std::string pattern;
+            Stats stats;
+        };
+
+        Report& mReport;
+        std::unordered_map<Key, std::vector<Entry>, KeyHash> mStats;
+    };
+
+    thread_local ThreadResults threadResults;
+    thread_local bool measuring = false;
+}
+
+MatchProfiler::Call::Call(const SourceLocation& location, const char pattern[])
+    : mLocation(location)
+    , mPattern(pattern)
+    , mNested(measuring)
+{
+    if (mNested)
+        return;
+    measuring = true;
+    mStart = std::chrono::steady_clock::now();
+}
+
+MatchProfiler::Call::~Call()
+{
+    if (mNested)
+        return;
+    const auto time = std::chrono::steady_clock::now() - mStart;
+    measuring = false;
+    threadResults.add(mLocation, mPattern, mMatched, std::chrono::duration_cast<std::chrono::nanoseconds>(time));
+}
+
+std::vector<std::string> MatchProfiler::takeResults()
+{
+    threadResults.flush();
+    return getReport().take();
+}
+
+void MatchProfiler::addResults(const std::string& results)
+{
+    std::string::size_type pos = 0;
+    std::vector<std::string> fields;
+    while (fields.size() < 6) {
+        const std::string::size_type end = results.find(';', pos);
+        if (end == std::string::npos)
+            return;
+        fields.push_back(results.substr(pos, end - pos));
+        pos = end + 1;
+    }
+    Stats stats;
+    stats.calls = std::strtoull(fields[3].c_str(), nullptr, 10);
+    stats.matches = std::strtoull(fields[4].c_str(), nullptr, 10);
+    stats.time = std::chrono::nanoseconds{std::strtoll(fields[5].c_str(), nullptr, 10)};
+    getReport().merge(Site(fields[0],
+                           static_cast<std::uint_least32_t>(std::strtoul(fields[1].c_str(), nullptr, 10)),
+                           static_cast<std::uint_least32_t>(std::strtoul(fields[2].c_str(), nullptr, 10)),
+                           results.substr(pos)),
+                      stats);
+}
+
+#endif
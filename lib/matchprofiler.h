@@ -0,0 +1,104 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef matchprofilerH
+#define matchprofilerH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+/**
+ * @file
+ * Profiling of the Token::Match() call sites.
+ *
+ * When built with CPPCHECK_MATCH_PROFILING defined (ENABLE_MATCH_PROFILING in
+ * CMake) the calls, matches and time of Token::Match(), Token::simpleMatch(),
+ * Token::findmatch() and Token::findsimplematch() are counted for each pattern
+ * and call site. A report sorted by the time is written at exit to the file
+ * specified by the CPPCHECK_MATCH_PROFILE environment variable or to stderr.
+ * The results of the processes forked by the ProcessExecutor are transferred to
+ * the main process which writes a single report.
+ *
+ * Calls which are made while another one is measured (e.g. the Token::Match()
+ * calls within Token::findmatch()) are not counted separately.
+ */
+
+#ifdef CPPCHECK_MATCH_PROFILING
+
+#include "sourcelocation.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace MatchProfiler {
+    /** @brief Measures a single call at the given call site */
+    class CPPCHECKLIB Call {
+    public:
+        Call(const SourceLocation& location, const char pattern[]);
+        ~Call();
+
+        Call(const Call&) = delete;
+        Call& operator=(const Call&) = delete;
+
+        template<class T>
+        T result(T res) {
+            mMatched = static_cast<bool>(res);
+            return res;
+        }
+
+    private:
+        const SourceLocation mLocation;
+        const char* const mPattern;
+        const bool mNested;
+        bool mMatched{};
+        std::chrono::steady_clock::time_point mStart;
+    };
+
+    /**
+     * @brief Take and clear the results of all threads which have been measured so far.
+     * This process does not write a report anymore - used to transfer the
+     * results of a forked process to the main process.
+     * @return the serialized results of each call site
+     */
+    CPPCHECKLIB std::vector<std::string> takeResults();
+
+    /** @brief Add the serialized results of a call site which were taken in another process */
+    CPPCHECKLIB void addResults(const std::string& results);
+}
+
+/** the additional parameter of the profiled functions which captures the call site */
+#define CPPCHECK_MATCH_LOCATION , const SourceLocation& matchLocation = SourceLocation::current()
+#define CPPCHECK_MATCH_LOCATION_DEF , const SourceLocation& matchLocation
+/** measure the given expression and return its result */
+#define CPPCHECK_MATCH_PROFILE(pattern, expr) \
+    MatchProfiler::Call matchProfilerCall(matchLocation, pattern); \
+    return matchProfilerCall.result(expr)
+
+#else
+
+#define CPPCHECK_MATCH_LOCATION
+#define CPPCHECK_MATCH_LOCATION_DEF
+#define CPPCHECK_MATCH_PROFILE(pattern, expr) return expr
+
+#endif
+
+//---------------------------------------------------------------------------
+#endif // matchprofilerH
+//---------------------------------------------------------------------------
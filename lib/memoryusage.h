@@ -0,0 +1,38 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef memoryusageH
+#define memoryusageH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <cstddef>
+
+namespace MemoryUsage {
+    /** @brief current resident set size of the process in bytes - 0 if not available */
+    CPPCHECKLIB std::size_t currentRss();
+
+    /** @brief peak resident set size of the process in bytes - 0 if not available */
+    CPPCHECKLIB std::size_t peakRss();
+}
+
+//---------------------------------------------------------------------------
+#endif // memoryusageH
+//---------------------------------------------------------------------------
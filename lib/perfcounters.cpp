@@ -0,0 +1,219 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "perfcounters.h"
+
+#include <cstddef>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+void PerfCounters::Values::add(const Values& other)
+{
+    for (std::size_t i = 0; i < EVENT_COUNT; ++i) {
+        if (!other.valid[i])
+            continue;
+        counts[i] += other.counts[i];
+        valid[i] = true;
+    }
+}
+
+PerfCounters::Values PerfCounters::Values::since(const Values& start) const
+{
+    Values diff;
+    for (std::size_t i = 0; i < EVENT_COUNT; ++i) {
+        if (!valid[i] || !start.valid[i])
+            continue;
+        // the scaled values of multiplexed counters might decrease slightly
+        diff.counts[i] = counts[i] > start.counts[i] ? counts[i] - start.counts[i] : 0;
+        diff.valid[i] = true;
+    }
+    return diff;
+}
+
+bool PerfCounters::Values::empty() const
+{
+    for (const bool v : valid) {
+        if (v)
+            return false;
+    }
+    return true;
+}
+
+const char* PerfCounters::name(Event event)
+{
+    switch (event) {
+    case CYCLES:
+        return "cycles";
+    case INSTRUCTIONS:
+        return "instructions";
+    case CACHE_MISSES:
+        return "cache-misses";
+    case BRANCH_MISSES:
+        return "branch-misses";
+    case EVENT_COUNT:
+        break;
+    }
+    return "";
+}
+
+#if defined(__linux__)
+namespace {
+    /** the counters of a single thread - they are read all at once as a group */
+    class Group {
+    public:
+        Group() = default;
+
+        ~Group() {
+            close();
+        }
+
+        Group(const Group&) = delete;
+        Group& operator=(const Group&) = delete;
+
+        /** open the counters unless they have already been opened by this process */
+        void open() {
+            const pid_t pid = getpid();
+            if (pid == mPid)
+                return;
+            // the descriptors of a forked process still count the thread of the parent
+            close();
+            mPid = pid;
+            mError.clear();
+
+            static const std::array<std::uint64_t, PerfCounters::EVENT_COUNT> configs = {
+                PERF_COUNT_HW_CPU_CYCLES,
+                PERF_COUNT_HW_INSTRUCTIONS,
+                PERF_COUNT_HW_CACHE_MISSES,
+                PERF_COUNT_HW_BRANCH_MISSES
+            };
+
+            int err = 0;
+            for (std::size_t i = 0; i < PerfCounters::EVENT_COUNT; ++i) {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = configs[i];
+                attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                // only count user space which is permitted with perf_event_paranoid <= 2
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+
+                const int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, mLeader, PERF_FLAG_FD_CLOEXEC));
+                if (fd < 0) {
+                    // a counter which is not supported by the hardware is skipped
+                    err = errno;
+                    continue;
+                }
+                if (mLeader == -1)
+                    mLeader = fd;
+                mFds[mCount] = fd;
+                mEvents[mCount] = static_cast<PerfCounters::Event>(i);
+                ++mCount;
+            }
+
+            if (mCount == 0) {
+                if (err == ENOENT || err == EOPNOTSUPP)
+                    mError = "no hardware performance counters available";
+                else
+                    mError = std::string("perf_event_open() failed: ") + std::strerror(err);
+                if (err == EACCES || err == EPERM)
+                    mError += " (see /proc/sys/kernel/perf_event_paranoid)";
+            }
+        }
+
+        bool read(PerfCounters::Values& values) const {
+            if (mCount == 0)
+                return false;
+
+            // nr, time_enabled, time_running and the values in the order the counters have been added to the group
+            std::array<std::uint64_t, 3 + PerfCounters::EVENT_COUNT> data{};
+            const ssize_t size = ::read(mLeader, data.data(), sizeof(data));
+            if (size < static_cast<ssize_t>((3 + mCount) * sizeof(std::uint64_t)) || data[0] != mCount)
+                return false;
+
+            const std::uint64_t enabled = data[1];
+            const std::uint64_t running = data[2];
+            if (running == 0)
+                return false;
+            for (std::size_t i = 0; i < mCount; ++i) {
+                std::uint64_t count = data[3 + i];
+                // the counters are multiplexed when there are more events than hardware counters
+                if (running < enabled)
+                    count = static_cast<std::uint64_t>(static_cast<double>(count) * static_cast<double>(enabled) / static_cast<double>(running));
+                values.counts[mEvents[i]] = count;
+                values.valid[mEvents[i]] = true;
+            }
+            return true;
+        }
+
+        const std::string& error() const {
+            return mError;
+        }
+
+    private:
+        void close() {
+            // close the members before the leader
+            for (std::size_t i = mCount; i > 0; --i)
+                ::close(mFds[i - 1]);
+            mCount = 0;
+            mLeader = -1;
+        }
+
+        pid_t mPid{};
+        int mLeader{-1};
+        std::size_t mCount{};
+        std::array<int, PerfCounters::EVENT_COUNT> mFds{};
+        std::array<PerfCounters::Event, PerfCounters::EVENT_COUNT> mEvents{};
+        std::string mError;
+    };
+
+    Group& getGroup()
+    {
+        thread_local Group group;
+        group.open();
+        return group;
+    }
+}
+#endif
+
+bool PerfCounters::read(Values& values)
+{
+    values = Values{};
+#if defined(__linux__)
+    return getGroup().read(values);
+#else
+    return false;
+#endif
+}
+
+std::string PerfCounters::error()
+{
+#if defined(__linux__)
+    return getGroup().error();
+#else
+    return "hardware performance counters are only supported on Linux";
+#endif
+}
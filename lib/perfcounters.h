@@ -0,0 +1,75 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef perfcountersH
+#define perfcountersH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Hardware performance counters of the calling thread.
+ *
+ * The counters are only available on Linux via perf_event_open(). They are
+ * opened for each thread on first use and only count user space so they also
+ * work with the default perf_event_paranoid setting.
+ */
+namespace PerfCounters {
+    enum Event : std::uint8_t {
+        CYCLES,
+        INSTRUCTIONS,
+        CACHE_MISSES,
+        BRANCH_MISSES,
+        EVENT_COUNT
+    };
+
+    /** @brief Counter values - a counter which is not supported by the hardware is not valid */
+    struct CPPCHECKLIB Values {
+        std::array<std::uint64_t, EVENT_COUNT> counts{};
+        std::array<bool, EVENT_COUNT> valid{};
+
+        /** @brief Accumulate the valid counters of another measurement */
+        void add(const Values& other);
+
+        /** @brief The difference of the counters since the given start */
+        Values since(const Values& start) const;
+
+        bool empty() const;
+    };
+
+    /** @brief name of the counter as used by perf */
+    CPPCHECKLIB const char* name(Event event);
+
+    /**
+     * @brief Read the current counters of the calling thread.
+     * @return false if no counter is available
+     */
+    CPPCHECKLIB bool read(Values& values);
+
+    /** @brief the reason why the counters are not available for the calling thread - empty if they are */
+    CPPCHECKLIB std::string error();
+}
+
+//---------------------------------------------------------------------------
+#endif // perfcountersH
+//---------------------------------------------------------------------------
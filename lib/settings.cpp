@@ -309,7 +309,7 @@ bool Settings::isEnabled(const ValueFlow::Value *value, bool inconclusiveCheck)
 
 void Settings::loadSummaries()
 {
-    Summaries::loadReturn(buildDir, summaryReturn);
+    Summaries::loadReturn(buildDir, summaryReturn, summaryReturnValue);
 }
 
 void Settings::setCheckLevel(CheckLevel level)
@@ -25,14 +25,17 @@
 #include "config.h"
 #include "errortypes.h"
 #include "library.h"
+#include "mathlib.h"
 #include "platform.h"
 #include "standards.h"
+#include "summaries.h"
 #include "checkers.h"
 
 #include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <list>
+#include <map>
 #include <set>
 #include <string>
 #include <tuple>
@@ -293,6 +296,9 @@ public:
     /** Library */
     Library library;
 
+    /** @brief write a record of each analysis limit which was hit to this file (--limits-report=<file>) */
+    std::string limitsReportFile;
+
 #ifdef HAS_THREADING_MODEL_FORK
     /** @brief Load average value */
     int loadAverage{};
@@ -358,6 +364,9 @@ public:
     /** @brief Using -E for debugging purposes */
     bool preprocessOnly{};
 
+    /** @brief --progress-stream=<target> : Write the progress as JSON lines to a file descriptor (fd:<n>) or UNIX socket (unix:<path>) */
+    std::string progressStream;
+
     /** @brief Is --quiet given? */
     bool quiet{};
 
@@ -367,6 +376,9 @@ public:
     /** @brief --report-progress */
     int reportProgress{-1};
 
+    /** @brief --report-slowest=<n> : Report the files with the longest analysis time recorded in the build dir */
+    int reportSlowest{};
+
 #ifdef HAVE_RULES
     /** Rule */
     struct CPPCHECKLIB Rule {
@@ -456,6 +468,12 @@ public:
     /** @brief show timing information (--showtime=file|summary|top5) */
     ShowTime showtime{};
 
+    /** @brief show memory usage information (--showmemory) */
+    bool showmemory{};
+
+    /** @brief show the hardware performance counters with the timing information (--showcounters) */
+    bool showcounters{};
+
     /** Struct contains standards settings */
     Standards standards;
 
@@ -467,6 +485,9 @@ public:
      *  text mode, e.g. "{file}:{line} {info}" */
     std::string templateLocation;
 
+    /** @brief write the timing information as trace in the Chrome trace event format to this file (--trace=<file>) */
+    std::string traceFile;
+
     /** @brief The maximum time in seconds for the template instantiation */
     std::size_t templateMaxTime{};
 
@@ -577,6 +598,9 @@ public:
 
     std::set<std::string> summaryReturn;
 
+    /** @brief return values of global functions in other translation units, from the summaries in the build dir */
+    std::map<std::string, Summaries::ReturnValue> summaryReturnValue;
+
     void loadSummaries();
 
     bool useSingleJob() const {
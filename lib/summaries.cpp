@@ -19,12 +19,14 @@
 #include "summaries.h"
 
 #include "analyzerinfo.h"
+#include "mathlib.h"
 #include "path.h"
 #include "settings.h"
 #include "symboldatabase.h"
 #include "token.h"
 #include "tokenize.h"
 #include "tokenlist.h"
+#include "utils.h"
 
 #include <algorithm>
 #include <fstream>
@@ -34,6 +36,44 @@
 #include <vector>
 
 
+static bool getConstantReturnValue(const Token *tok, MathLib::bigint &value)
+{
+    if (Token::Match(tok, "nullptr|NULL")) {
+        value = 0;
+        return true;
+    }
+    bool negative = false;
+    if (tok && tok->str() == "-" && !tok->astOperand2()) {
+        negative = true;
+        tok = tok->astOperand1();
+    }
+    if (!tok || !tok->isNumber() || !MathLib::isInt(tok->str()))
+        return false;
+    value = MathLib::toBigNumber(tok);
+    if (negative)
+        value = -value;
+    return true;
+}
+
+/** the value returned by all return statements of a global function, for use in other translation units */
+static bool getConstantReturnValue(const Function *f, MathLib::bigint &value)
+{
+    // the summaries are looked up by the unqualified name so functions in namespaces are not written
+    if (f->isStatic() || !f->nestedIn || f->nestedIn->type != ScopeType::eGlobal)
+        return false;
+    const std::vector<const Token*> returns = Function::findReturns(f);
+    if (returns.empty())
+        return false;
+    for (std::size_t i = 0; i < returns.size(); ++i) {
+        MathLib::bigint v = 0;
+        if (!getConstantReturnValue(returns[i], v))
+            return false;
+        if (i > 0 && v != value)
+            return false;
+        value = v;
+    }
+    return true;
+}
 
 std::string Summaries::create(const Tokenizer &tokenizer, const std::string &cfg, std::size_t fsFileId)
 {
@@ -73,6 +113,9 @@ std::string Summaries::create(const Tokenizer &tokenizer, const std::string &cfg
         };
 
         ostr << f->name();
+        MathLib::bigint returnValue = 0;
+        if (getConstantReturnValue(f, returnValue))
+            ostr << " return:[" << returnValue << "] argc:[" << f->argCount() << "]";
         if (!globalVars.empty())
             ostr << " global:[" << join(globalVars) << "]";
         if (!calledFunctions.empty())
@@ -130,7 +173,7 @@ static std::vector<std::string> getSummaryData(const std::string &line, const st
     std::string::size_type pos1 = start + 3 + data.size();
     while (pos1 < end) {
         const std::string::size_type pos2 = line.find_first_of(",]",pos1);
-        ret.push_back(line.substr(pos1, pos2-pos1-1));
+        ret.push_back(line.substr(pos1, pos2-pos1));
         pos1 = pos2 + 1;
     }
 
@@ -154,7 +197,7 @@ static void removeFunctionCalls(const std::string& calledFunction,
     }
 }
 
-void Summaries::loadReturn(const std::string &buildDir, std::set<std::string> &summaryReturn)
+void Summaries::loadReturn(const std::string &buildDir, std::set<std::string> &summaryReturn, std::map<std::string, ReturnValue> &summaryReturnValue)
 {
     if (buildDir.empty())
         return;
@@ -162,6 +205,8 @@ void Summaries::loadReturn(const std::string &buildDir, std::set<std::string> &s
     std::vector<std::string> return1;
     std::map<std::string, std::vector<std::string>> functionCalls;
     std::map<std::string, std::vector<std::string>> functionCalledBy;
+    // functions that are defined several times with different return values
+    std::set<std::string> ambiguousReturnValue;
 
     // extract "functionNoreturn" and "functionCalledBy" from summaries
     std::vector<std::string> summaryFiles = getSummaryFiles(buildDir + "/files.txt");
@@ -175,6 +220,23 @@ void Summaries::loadReturn(const std::string &buildDir, std::set<std::string> &s
             constexpr std::string::size_type pos1 = 0;
             const std::string::size_type pos2 = line.find(' ', pos1);
             std::string functionName = (pos2 == std::string::npos) ? line : line.substr(0, pos2);
+            const std::vector<std::string> returnValue = getSummaryData(line, "return");
+            const std::vector<std::string> argCount = getSummaryData(line, "argc");
+            if (ambiguousReturnValue.count(functionName) == 0) {
+                ReturnValue r{};
+                const bool valid = returnValue.size() == 1 && MathLib::isInt(returnValue[0]) && argCount.size() == 1 && strToInt(argCount[0], r.argCount);
+                if (valid)
+                    r.value = MathLib::toBigNumber(returnValue[0]);
+                // overloads and functions with different return values in several files are not used
+                const auto it = summaryReturnValue.find(functionName);
+                if (valid && (it == summaryReturnValue.end() || (it->second.value == r.value && it->second.argCount == r.argCount))) {
+                    summaryReturnValue[functionName] = r;
+                } else {
+                    if (it != summaryReturnValue.end())
+                        summaryReturnValue.erase(it);
+                    ambiguousReturnValue.insert(functionName);
+                }
+            }
             std::vector<std::string> call = getSummaryData(line, "call");
             if (call.empty())
                 return1.push_back(functionName);
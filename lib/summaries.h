@@ -22,16 +22,24 @@
 //---------------------------------------------------------------------------
 
 #include "config.h"
+#include "mathlib.h"
 
 #include <cstddef>
+#include <map>
 #include <set>
 #include <string>
 
 class Tokenizer;
 
 namespace Summaries {
+    /** value returned by a global function and its number of arguments */
+    struct ReturnValue {
+        MathLib::bigint value;
+        int argCount;
+    };
+
     CPPCHECKLIB std::string create(const Tokenizer &tokenizer, const std::string &cfg, std::size_t fsFileId);
-    CPPCHECKLIB void loadReturn(const std::string &buildDir, std::set<std::string> &summaryReturn);
+    CPPCHECKLIB void loadReturn(const std::string &buildDir, std::set<std::string> &summaryReturn, std::map<std::string, ReturnValue> &summaryReturnValue);
 }
 
 //---------------------------------------------------------------------------
@@ -1186,6 +1186,15 @@ void SymbolDatabase::createSymbolDatabaseSetFunctionPointers(bool firstPass)
         }
     }
 
+    // Names of all functions. Unless the name is qualified, findFunction() only
+    // looks for functions with the same name as the token, so there is no need
+    // to search the scopes and base classes for other names.
+    std::unordered_set<std::string> functionNames;
+    for (const Scope& scope: scopeList) {
+        for (const Function& func: scope.functionList)
+            functionNames.insert(func.name());
+    }
+
     // Set function call pointers
     const Token* inTemplateArg = nullptr;
     for (Token* tok = mTokenizer.list.front(); tok != mTokenizer.list.back(); tok = tok->next()) {
@@ -1197,6 +1206,9 @@ void SymbolDatabase::createSymbolDatabaseSetFunctionPointers(bool firstPass)
             if (tok->strAt(1) == ">" && !tok->linkAt(1))
                 continue;
 
+            if (functionNames.find(tok->str()) == functionNames.end() && tok->strAt(-1) != "::")
+                continue;
+
             const Function *function = findFunction(tok);
             if (!function || (inTemplateArg && function->isConstructor()))
                 continue;
@@ -21,6 +21,7 @@
 #define symboldatabaseH
 //---------------------------------------------------------------------------
 
+#include "chunkedlist.h"
 #include "config.h"
 #include "errortypes.h"
 #include "library.h"
@@ -1049,7 +1050,8 @@ public:
     const Token* classDef{};   ///< class/struct/union/namespace token
     const Token* bodyStart{};  ///< '{' token
     const Token* bodyEnd{};    ///< '}' token
-    std::list<Function> functionList;
+    // most scopes have only a few functions so the chunks start with a single one
+    ChunkedList<Function, 1> functionList;
     std::multimap<std::string, const Function *> functionMap;
     std::list<Variable> varlist;
     const Scope* nestedIn{};
@@ -1342,7 +1344,7 @@ public:
     ~SymbolDatabase();
 
     /** @brief Information about all namespaces/classes/structures */
-    std::list<Scope> scopeList;
+    ChunkedList<Scope> scopeList;
 
     /** @brief Fast access to function scopes */
     std::vector<const Scope*> functionScopes;
@@ -1351,7 +1353,7 @@ public:
     std::vector<const Scope*> classAndStructScopes;
 
     /** @brief Fast access to types */
-    std::list<Type> typeList;
+    ChunkedList<Type> typeList;
 
     /**
      * @brief find a variable type if it's a user defined type
@@ -30,11 +30,13 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <stack>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 
 static Token *skipRequires(Token *tok)
@@ -83,16 +85,6 @@ namespace {
     private:
         const std::string mName;
     };
-
-    class FindFullName {
-    public:
-        explicit FindFullName(std::string fullName) : mFullName(std::move(fullName)) {}
-        bool operator()(const TemplateSimplifier::TokenAndName &tokenAndName) const {
-            return tokenAndName.fullName() == mFullName;
-        }
-    private:
-        const std::string mFullName;
-    };
 }
 
 TemplateSimplifier::TokenAndName::TokenAndName(Token *token, std::string scope) :
@@ -802,6 +794,11 @@ void TemplateSimplifier::getTemplateInstantiations()
             functionNameMap.emplace(decl.name(), &decl);
     }
 
+    // first declaration with a given full name
+    std::unordered_map<std::string, const TokenAndName *> fullNameMap;
+    for (const auto & decl : mTemplateDeclarations)
+        fullNameMap.emplace(decl.fullName(), &decl);
+
     const Token *skip = nullptr;
 
     for (Token *tok = mTokenList.front(); tok; tok = tok->next()) {
@@ -996,10 +993,10 @@ void TemplateSimplifier::getTemplateInstantiations()
                 while (true) {
                     std::string fullName = scopeName + (scopeName.empty()?"":" :: ") +
                                            qualification + (qualification.empty()?"":" :: ") + tok->str();
-                    const auto it = std::find_if(mTemplateDeclarations.cbegin(), mTemplateDeclarations.cend(), FindFullName(std::move(fullName)));
-                    if (it != mTemplateDeclarations.end()) {
+                    const auto it = fullNameMap.find(fullName);
+                    if (it != fullNameMap.end()) {
                         // full name matches
-                        addInstantiation(tok, it->scope());
+                        addInstantiation(tok, it->second->scope());
                         break;
                     }
                     // full name doesn't match so try with using namespaces if available
@@ -1008,8 +1005,8 @@ void TemplateSimplifier::getTemplateInstantiations()
                         std::string fullNameSpace = scopeName + (scopeName.empty()?"":" :: ") +
                                                     nameSpace + (qualification.empty()?"":" :: ") + qualification;
                         std::string newFullName = fullNameSpace + " :: " + tok->str();
-                        const auto it1 = std::find_if(mTemplateDeclarations.cbegin(), mTemplateDeclarations.cend(), FindFullName(std::move(newFullName)));
-                        if (it1 != mTemplateDeclarations.end()) {
+                        const auto it1 = fullNameMap.find(newFullName);
+                        if (it1 != fullNameMap.end()) {
                             // insert using namespace into token stream
                             std::string::size_type offset = 0;
                             std::string::size_type pos = 0;
@@ -1019,7 +1016,7 @@ void TemplateSimplifier::getTemplateInstantiations()
                             }
                             qualificationTok->insertTokenBefore(nameSpace.substr(offset));
                             qualificationTok->insertTokenBefore("::");
-                            addInstantiation(tok, it1->scope());
+                            addInstantiation(tok, it1->second->scope());
                             found = true;
                             break;
                         }
@@ -3236,6 +3233,10 @@ bool TemplateSimplifier::simplifyTemplateInstantiations(
             mErrorLogger.reportProgress(mTokenList.getFiles()[0], "TemplateSimplifier::simplifyTemplateInstantiations()", tok2->progressValue());
 
         if (maxtime > 0 && std::time(nullptr) > maxtime) {
+            if (!mSettings.limitsReportFile.empty()) {
+                const std::time_t elapsed = std::time(nullptr) - maxtime + static_cast<std::time_t>(mSettings.templateMaxTime);
+                mErrorLogger.reportLimit(mTokenList.getSourceFilePath(), templateDeclaration.fullName(), "templateMaxTime", mSettings.templateMaxTime, mInstantiatedTemplates.size(), elapsed * 1000);
+            }
             if (mSettings.debugwarnings) {
                 ErrorMessage::FileLocation loc(mTokenList.getFiles()[0], 0, 0);
                 ErrorMessage errmsg({std::move(loc)},
@@ -3312,6 +3313,10 @@ bool TemplateSimplifier::simplifyTemplateInstantiations(
             mErrorLogger.reportProgress(mTokenList.getFiles()[0], "TemplateSimplifier::simplifyTemplateInstantiations()", tok2->progressValue());
 
         if (maxtime > 0 && std::time(nullptr) > maxtime) {
+            if (!mSettings.limitsReportFile.empty()) {
+                const std::time_t elapsed = std::time(nullptr) - maxtime + static_cast<std::time_t>(mSettings.templateMaxTime);
+                mErrorLogger.reportLimit(mTokenList.getSourceFilePath(), templateDeclaration.fullName(), "templateMaxTime", mSettings.templateMaxTime, mInstantiatedTemplates.size(), elapsed * 1000);
+            }
             if (mSettings.debugwarnings) {
                 ErrorMessage::FileLocation loc(mTokenList.getFiles()[0], 0, 0);
                 ErrorMessage errmsg({std::move(loc)},
@@ -3803,6 +3808,8 @@ void TemplateSimplifier::printOut(const std::string & text) const
 
 void TemplateSimplifier::simplifyTemplates(const std::time_t maxtime)
 {
+    const auto startTime = std::chrono::steady_clock::now();
+
     // convert "sizeof ..." to "sizeof..."
     for (Token *tok = mTokenList.front(); tok; tok = tok->next()) {
         if (Token::simpleMatch(tok, "sizeof ...")) {
@@ -3965,19 +3972,20 @@ void TemplateSimplifier::simplifyTemplates(const std::time_t maxtime)
 
         std::set<std::string> expandedtemplates;
 
+        // get specializations..
+        // the declarations are not modified while instantiating so collect them once per pass
+        std::unordered_map<std::string, std::list<const Token *>> specializationsMap;
+        for (const TokenAndName& decl : mTemplateDeclarations) {
+            if (decl.isAlias() || decl.isFriend())
+                continue;
+            specializationsMap[decl.fullName()].push_back(decl.nameToken());
+        }
+
         for (auto iter1 = mTemplateDeclarations.crbegin(); iter1 != mTemplateDeclarations.crend(); ++iter1) {
             if (iter1->isAlias() || iter1->isFriend())
                 continue;
 
-            // get specializations..
-            std::list<const Token *> specializations;
-            for (auto iter2 = mTemplateDeclarations.cbegin(); iter2 != mTemplateDeclarations.cend(); ++iter2) {
-                if (iter2->isAlias() || iter2->isFriend())
-                    continue;
-
-                if (iter1->fullName() == iter2->fullName())
-                    specializations.push_back(iter2->nameToken());
-            }
+            const std::list<const Token *>& specializations = specializationsMap[iter1->fullName()];
 
             const bool instantiated = simplifyTemplateInstantiations(
                 *iter1,
@@ -4050,6 +4058,10 @@ void TemplateSimplifier::simplifyTemplates(const std::time_t maxtime)
     }
 
     if (passCount == passCountMax) {
+        if (!mSettings.limitsReportFile.empty()) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+            mErrorLogger.reportLimit(mTokenList.getSourceFilePath(), "", "templatePassCountMax", passCountMax, passCount, elapsed.count());
+        }
         if (mSettings.debugwarnings) {
             const std::list<const Token*> locationList(1, mTokenList.front());
             const ErrorMessage errmsg(locationList, &mTokenizer.list,
@@ -18,43 +18,310 @@
 
 #include "timer.h"
 
+#include "json.h"
+#include "memoryusage.h"
+
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iomanip>
 #include <iostream>
-#include <numeric>
+#include <iterator>
+#include <sstream>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#ifndef _WIN32
+#include <unistd.h> // for getpid()
+#else
+#include <process.h> // for getpid()
+#endif
+
 namespace {
     // TODO: remove and print through (synchronized) ErrorLogger instead
     std::mutex stdCoutLock;
+
+    // file and configuration the current thread is working on
+    thread_local std::string traceFile;
+    thread_local std::string traceConfiguration;
+
+    // the names of the running measurements of the current thread which are reported to the phase listener
+    thread_local std::vector<std::string> phases;
+
+    /** the process-wide registered timer names - the index is the timer id */
+    struct TimerRegistry {
+        std::mutex sync;
+        std::unordered_map<std::string, TimerResults::Id> ids;
+        std::vector<std::string> names;
+    };
+
+    TimerRegistry& getRegistry()
+    {
+        static TimerRegistry registry;
+        return registry;
+    }
+
+    /** statistics which are only written by a single thread but may be read by others */
+    struct AtomicStats {
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> sum{0};
+        std::atomic<std::uint64_t> min{std::numeric_limits<std::uint64_t>::max()};
+        std::atomic<std::uint64_t> max{0};
+
+        void add(std::uint64_t duration) {
+            count.fetch_add(1, std::memory_order_relaxed);
+            sum.fetch_add(duration, std::memory_order_relaxed);
+            std::uint64_t cur = min.load(std::memory_order_relaxed);
+            while (duration < cur && !min.compare_exchange_weak(cur, duration, std::memory_order_relaxed)) {}
+            cur = max.load(std::memory_order_relaxed);
+            while (duration > cur && !max.compare_exchange_weak(cur, duration, std::memory_order_relaxed)) {}
+        }
+
+        TimerStats get() const {
+            TimerStats stats;
+            stats.count = count.load(std::memory_order_relaxed);
+            stats.sum = std::chrono::nanoseconds{sum.load(std::memory_order_relaxed)};
+            stats.min = std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(std::min<std::uint64_t>(min.load(std::memory_order_relaxed), std::chrono::nanoseconds::max().count()))};
+            stats.max = std::chrono::nanoseconds{max.load(std::memory_order_relaxed)};
+            return stats;
+        }
+
+        void clear() {
+            count.store(0, std::memory_order_relaxed);
+            sum.store(0, std::memory_order_relaxed);
+            min.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+            max.store(0, std::memory_order_relaxed);
+        }
+    };
+
+    /** hardware performance counters which are only written by a single thread but may be read by others */
+    struct AtomicCounters {
+        std::array<std::atomic<std::uint64_t>, PerfCounters::EVENT_COUNT> counts;
+        std::array<std::atomic<bool>, PerfCounters::EVENT_COUNT> valid;
+
+        AtomicCounters() {
+            clear();
+        }
+
+        void add(const PerfCounters::Values& values) {
+            for (std::size_t i = 0; i < PerfCounters::EVENT_COUNT; ++i) {
+                if (!values.valid[i])
+                    continue;
+                counts[i].fetch_add(values.counts[i], std::memory_order_relaxed);
+                valid[i].store(true, std::memory_order_relaxed);
+            }
+        }
+
+        PerfCounters::Values get() const {
+            PerfCounters::Values values;
+            for (std::size_t i = 0; i < PerfCounters::EVENT_COUNT; ++i) {
+                values.counts[i] = counts[i].load(std::memory_order_relaxed);
+                values.valid[i] = valid[i].load(std::memory_order_relaxed);
+            }
+            return values;
+        }
+
+        void clear() {
+            for (std::size_t i = 0; i < PerfCounters::EVENT_COUNT; ++i) {
+                counts[i].store(0, std::memory_order_relaxed);
+                valid[i].store(false, std::memory_order_relaxed);
+            }
+        }
+    };
 }
 
-// TODO: this does not include any file context when SHOWTIME_FILE thus rendering it useless - should we include the logging with the progress logging?
-// that could also get rid of the broader locking
-void TimerResults::showResults(size_t max_results, bool metrics) const
+/**
+ * Slots indexed by the timer id. They are stored in chunks which are never
+ * moved so they can be read while the owning thread adds new ones.
+ */
+template<class T>
+class Slots {
+public:
+    static constexpr std::size_t ChunkSize = 64;
+    static constexpr std::size_t MaxChunks = 256;
+
+    Slots() {
+        for (std::atomic<T*>& chunk : mChunks)
+            chunk.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~Slots() {
+        for (std::atomic<T*>& chunk : mChunks)
+            delete[] chunk.load(std::memory_order_relaxed);
+    }
+
+    Slots(const Slots&) = delete;
+    Slots& operator=(const Slots&) = delete;
+
+    /** only to be called by the owning thread */
+    T* get(TimerResults::Id id) {
+        if (id >= ChunkSize * MaxChunks)
+            return nullptr;
+        std::atomic<T*>& chunk = mChunks[id / ChunkSize];
+        T* slots = chunk.load(std::memory_order_relaxed);
+        if (!slots) {
+            slots = new T[ChunkSize];
+            chunk.store(slots, std::memory_order_release);
+        }
+        return &slots[id % ChunkSize];
+    }
+
+    template<class F>
+    void forEach(const F& f) const {
+        for (std::size_t i = 0; i < MaxChunks; ++i) {
+            T* const slots = mChunks[i].load(std::memory_order_acquire);
+            if (!slots)
+                continue;
+            for (std::size_t j = 0; j < ChunkSize; ++j)
+                f(i * ChunkSize + j, slots[j]);
+        }
+    }
+
+private:
+    std::array<std::atomic<T*>, MaxChunks> mChunks;
+};
+
+/** The measurements of a single thread */
+class TimerResults::Bucket {
+public:
+    Slots<AtomicStats> stats;
+
+    /** only allocated when the hardware performance counters are measured */
+    Slots<AtomicCounters> counters;
+
+    /** memory measurements - only accessed by the owning thread */
+    std::map<std::string, MemoryStats> memory;
+    std::map<std::string, MemoryStats> objects;
+};
+
+void TimerStats::add(std::chrono::nanoseconds duration)
 {
-    using dataElementType = std::pair<std::string, std::vector<std::chrono::milliseconds>>;
+    ++count;
+    sum += duration;
+    min = std::min(min, duration);
+    max = std::max(max, duration);
+}
 
-    std::vector<dataElementType> data;
-    {
-        std::lock_guard<std::mutex> l(mResultsSync);
+void TimerStats::merge(const TimerStats& other)
+{
+    if (other.count == 0)
+        return;
+    count += other.count;
+    sum += other.sum;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+}
 
-        data.reserve(mResults.size());
-        data.insert(data.begin(), mResults.cbegin(), mResults.cend());
+static std::uint64_t nextTimerResultsSerial()
+{
+    static std::atomic<std::uint64_t> serial{1};
+    return serial++;
+}
+
+TimerResults::TimerResults()
+    : mSerial(nextTimerResultsSerial())
+{}
+
+TimerResults::~TimerResults() = default;
+
+TimerResults::Id TimerResults::getId(const std::string& name)
+{
+    // look up the id without locking once the thread has used the timer
+    thread_local std::unordered_map<std::string, Id> cache;
+    const auto it = cache.find(name);
+    if (it != cache.cend())
+        return it->second;
+
+    TimerRegistry& registry = getRegistry();
+    Id id;
+    {
+        std::lock_guard<std::mutex> l(registry.sync);
+        const auto res = registry.ids.emplace(name, registry.names.size());
+        if (res.second)
+            registry.names.push_back(name);
+        id = res.first->second;
     }
+    cache.emplace(name, id);
+    return id;
+}
 
-    const auto asSeconds = [](std::chrono::milliseconds ms) -> std::chrono::duration<double> {
-        return std::chrono::duration_cast<std::chrono::duration<double>>(ms);
+TimerResults::Bucket& TimerResults::getBucket()
+{
+    struct Cache {
+        std::uint64_t serial;
+        Bucket* bucket;
     };
+    thread_local Cache cache{0, nullptr};
+    if (cache.serial == mSerial)
+        return *cache.bucket;
 
-    const auto getSeconds = [&asSeconds](const std::vector<std::chrono::milliseconds>& results) -> std::chrono::duration<double> {
-        return std::accumulate(results.cbegin(), results.cend(), std::chrono::duration<double>{}, [&asSeconds](std::chrono::duration<double> secs, std::chrono::milliseconds duration) {
-            return secs + asSeconds(duration);
-        });
+    std::lock_guard<std::mutex> l(mResultsSync);
+    std::unique_ptr<Bucket>& bucket = mBuckets[std::this_thread::get_id()];
+    if (!bucket)
+        bucket.reset(new Bucket);
+    cache.serial = mSerial;
+    cache.bucket = bucket.get();
+    return *bucket;
+}
+
+/** the counters in the format " [cycles: 1 / instructions: 2 (IPC 2.00) / ...]" - empty if there are none */
+static std::string countersToString(const PerfCounters::Values& counters)
+{
+    if (counters.empty())
+        return "";
+
+    std::ostringstream ostr;
+    ostr << " [";
+    bool first = true;
+    for (std::size_t i = 0; i < PerfCounters::EVENT_COUNT; ++i) {
+        if (!counters.valid[i])
+            continue;
+        if (!first)
+            ostr << " / ";
+        first = false;
+        ostr << PerfCounters::name(static_cast<PerfCounters::Event>(i)) << ": " << counters.counts[i];
+        if (i == PerfCounters::INSTRUCTIONS && counters.valid[PerfCounters::CYCLES] && counters.counts[PerfCounters::CYCLES] > 0)
+            ostr << " (IPC " << std::fixed << std::setprecision(2) << static_cast<double>(counters.counts[i]) / static_cast<double>(counters.counts[PerfCounters::CYCLES]) << ")";
+    }
+    ostr << "]";
+    return ostr.str();
+}
+
+static int getPid()
+{
+#ifndef _WIN32
+    return getpid();
+#else
+    return _getpid();
+#endif
+}
+
+/** small sequential id of the current thread which is easier to read in the trace viewer than std::thread::id */
+static int getTraceThreadId()
+{
+    static std::atomic<int> nextId{1};
+    thread_local const int id = nextId++;
+    return id;
+}
+
+// TODO: this does not include any file context when SHOWTIME_FILE thus rendering it useless - should we include the logging with the progress logging?
+// that could also get rid of the broader locking
+void TimerResults::showResults(size_t max_results, bool metrics) const
+{
+    using dataElementType = std::pair<std::string, TimerStats>;
+
+    const std::map<std::string, TimerStats> results = getResults();
+    std::vector<dataElementType> data(results.cbegin(), results.cend());
+    const std::map<std::string, PerfCounters::Values> counters = getCounters();
+
+    const auto asSeconds = [](std::chrono::nanoseconds ns) -> double {
+        return std::chrono::duration_cast<std::chrono::duration<double>>(ns).count();
     };
 
-    std::sort(data.begin(), data.end(), [&getSeconds](const dataElementType& lhs, const dataElementType& rhs) -> bool {
-        return getSeconds(lhs.second) > getSeconds(rhs.second);
+    std::sort(data.begin(), data.end(), [](const dataElementType& lhs, const dataElementType& rhs) -> bool {
+        return lhs.second.sum > rhs.second.sum;
     });
 
     // lock the whole logging operation to avoid multiple threads printing their results at the same time
@@ -63,13 +330,15 @@ void TimerResults::showResults(size_t max_results, bool metrics) const
     size_t ordinal = 1; // maybe it would be nice to have an ordinal in output later!
     for (auto iter=data.cbegin(); iter!=data.cend(); ++iter) {
         if (ordinal <= max_results) {
-            const double sec = getSeconds(iter->second).count();
+            const TimerStats& stats = iter->second;
+            const double sec = asSeconds(stats.sum);
             std::cout << iter->first << ": " << sec << "s";
             if (metrics) {
-                const double secAverage = sec / static_cast<double>(iter->second.size());
-                const double secMin = asSeconds(*std::min_element(iter->second.cbegin(), iter->second.cend())).count();
-                const double secMax = asSeconds(*std::max_element(iter->second.cbegin(), iter->second.cend())).count();
-                std::cout << " (avg. " << secAverage << "s / min " << secMin << "s / max " << secMax << "s - " << iter->second.size() << " result(s))";
+                const double secAverage = sec / static_cast<double>(stats.count);
+                std::cout << " (avg. " << secAverage << "s / min " << asSeconds(stats.min) << "s / max " << asSeconds(stats.max) << "s - " << stats.count << " result(s))";
+                const auto it = counters.find(iter->first);
+                if (it != counters.cend())
+                    std::cout << countersToString(it->second);
             }
             std::cout << std::endl;
         }
@@ -77,25 +346,307 @@ void TimerResults::showResults(size_t max_results, bool metrics) const
     }
 }
 
-void TimerResults::addResults(const std::string& name, std::chrono::milliseconds duration)
+void TimerResults::addResults(const std::string& name, std::chrono::nanoseconds duration)
+{
+    addResults(getId(name), duration);
+}
+
+void TimerResults::addResults(Id id, std::chrono::nanoseconds duration)
+{
+    AtomicStats* const stats = getBucket().stats.get(id);
+    if (stats) {
+        stats->add(duration.count());
+        return;
+    }
+
+    // out of space for the lock-free statistics
+    std::string name;
+    {
+        TimerRegistry& registry = getRegistry();
+        std::lock_guard<std::mutex> l(registry.sync);
+        name = registry.names[id];
+    }
+    std::lock_guard<std::mutex> l(mResultsSync);
+    mResults[name].add(duration);
+}
+
+void TimerResults::addResults(Id id, const std::string& /*name*/, std::chrono::nanoseconds duration)
 {
+    addResults(id, duration);
+}
+
+void TimerResults::addResults(const std::string& name, const TimerStats& stats)
+{
+    if (stats.count == 0)
+        return;
     std::lock_guard<std::mutex> l(mResultsSync);
+    mResults[name].merge(stats);
+}
+
+std::map<std::string, TimerStats> TimerResults::getResults() const
+{
+    std::vector<TimerStats> stats;
+    std::map<std::string, TimerStats> results;
+    {
+        std::lock_guard<std::mutex> l(mResultsSync);
+        for (const auto& bucket : mBuckets) {
+            bucket.second->stats.forEach([&stats](Id id, const AtomicStats& s) {
+                if (id >= stats.size())
+                    stats.resize(id + 1);
+                stats[id].merge(s.get());
+            });
+        }
+        results = mResults;
+    }
 
-    mResults[name].push_back(duration);
+    TimerRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> l(registry.sync);
+    for (Id id = 0; id < stats.size(); ++id) {
+        if (stats[id].count > 0)
+            results[registry.names[id]].merge(stats[id]);
+    }
+    return results;
+}
+
+std::map<std::string, std::chrono::nanoseconds> TimerResults::getThreadResults()
+{
+    std::vector<std::pair<Id, std::chrono::nanoseconds>> sums;
+    getBucket().stats.forEach([&sums](Id id, const AtomicStats& s) {
+        const TimerStats stats = s.get();
+        if (stats.count > 0)
+            sums.emplace_back(id, stats.sum);
+    });
+
+    std::map<std::string, std::chrono::nanoseconds> results;
+    TimerRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> l(registry.sync);
+    for (const auto& sum : sums)
+        results[registry.names[sum.first]] = sum.second;
+    return results;
 }
 
 void TimerResults::reset()
 {
     std::lock_guard<std::mutex> l(mResultsSync);
+    for (const auto& bucket : mBuckets) {
+        bucket.second->stats.forEach([](Id /*id*/, AtomicStats& s) {
+            s.clear();
+        });
+        bucket.second->counters.forEach([](Id /*id*/, AtomicCounters& c) {
+            c.clear();
+        });
+    }
     mResults.clear();
+    mTraceEvents.clear();
+    mCounterResults.clear();
+}
+
+void TimerResults::addSpan(const std::string& name, std::chrono::nanoseconds start, std::chrono::nanoseconds duration)
+{
+    if (!mTrace)
+        return;
+
+    picojson::object args;
+    args["file"] = picojson::value(traceFile);
+    args["cfg"] = picojson::value(traceConfiguration);
+
+    // "complete" event, the timestamps are in microseconds
+    picojson::object event;
+    event["name"] = picojson::value(name);
+    event["cat"] = picojson::value("cppcheck");
+    event["ph"] = picojson::value("X");
+    event["ts"] = picojson::value(static_cast<double>(start.count()) / 1000.0);
+    event["dur"] = picojson::value(static_cast<double>(duration.count()) / 1000.0);
+    event["pid"] = picojson::value(static_cast<int64_t>(getPid()));
+    event["tid"] = picojson::value(static_cast<int64_t>(getTraceThreadId()));
+    event["args"] = picojson::value(args);
+
+    addTraceEvent(picojson::value(event).serialize());
+}
+
+void TimerResults::addTraceEvent(std::string event)
+{
+    std::lock_guard<std::mutex> l(mResultsSync);
+    mTraceEvents.push_back(std::move(event));
+}
+
+void TimerResults::writeTrace(std::ostream& out) const
+{
+    std::lock_guard<std::mutex> l(mResultsSync);
+
+    out << "{\"traceEvents\":[";
+    for (auto it = mTraceEvents.cbegin(); it != mTraceEvents.cend(); ++it) {
+        if (it != mTraceEvents.cbegin())
+            out << ',';
+        out << '\n' << *it;
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+}
+
+void TimerResults::addMemory(const std::string& name, std::int64_t bytes)
+{
+    MemoryStats& stats = getBucket().memory[name];
+    ++stats.count;
+    stats.bytes += bytes;
+}
+
+void TimerResults::addCounters(const std::string& name, const PerfCounters::Values& counters)
+{
+    addCounters(getId(name), counters);
+}
+
+void TimerResults::addCounters(Id id, const PerfCounters::Values& counters)
+{
+    AtomicCounters* const c = getBucket().counters.get(id);
+    if (c) {
+        c->add(counters);
+        return;
+    }
+
+    // out of space for the lock-free counters
+    std::string name;
+    {
+        TimerRegistry& registry = getRegistry();
+        std::lock_guard<std::mutex> l(registry.sync);
+        name = registry.names[id];
+    }
+    std::lock_guard<std::mutex> l(mResultsSync);
+    mCounterResults[name].add(counters);
+}
+
+void TimerResults::addCounters(Id id, const std::string& /*name*/, const PerfCounters::Values& counters)
+{
+    addCounters(id, counters);
+}
+
+std::map<std::string, PerfCounters::Values> TimerResults::getCounters() const
+{
+    std::vector<PerfCounters::Values> values;
+    std::map<std::string, PerfCounters::Values> results;
+    {
+        std::lock_guard<std::mutex> l(mResultsSync);
+        for (const auto& bucket : mBuckets) {
+            bucket.second->counters.forEach([&values](Id id, const AtomicCounters& c) {
+                if (id >= values.size())
+                    values.resize(id + 1);
+                values[id].add(c.get());
+            });
+        }
+        results = mCounterResults;
+    }
+
+    TimerRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> l(registry.sync);
+    for (Id id = 0; id < values.size(); ++id) {
+        if (!values[id].empty())
+            results[registry.names[id]].add(values[id]);
+    }
+    return results;
+}
+
+void TimerResults::addObjects(const std::string& name, std::size_t count, std::size_t size)
+{
+    MemoryStats& stats = getBucket().objects[name];
+    stats.count += count;
+    stats.bytes += static_cast<std::int64_t>(count * size);
+}
+
+void TimerResults::showMemory()
+{
+    using dataElementType = std::pair<std::string, MemoryStats>;
+
+    Bucket& bucket = getBucket();
+    std::vector<dataElementType> memory(bucket.memory.cbegin(), bucket.memory.cend());
+    std::vector<dataElementType> objects(bucket.objects.cbegin(), bucket.objects.cend());
+    bucket.memory.clear();
+    bucket.objects.clear();
+
+    const auto compare = [](const dataElementType& lhs, const dataElementType& rhs) -> bool {
+        return lhs.second.bytes > rhs.second.bytes;
+    };
+    std::sort(memory.begin(), memory.end(), compare);
+    std::sort(objects.begin(), objects.end(), compare);
+
+    const std::size_t peakRss = getPeakRss();
+
+    // lock the whole logging operation to avoid multiple threads printing their results at the same time
+    std::lock_guard<std::mutex> l(stdCoutLock);
+
+    for (const dataElementType& m : memory)
+        std::cout << m.first << ": " << (m.second.bytes >= 0 ? "+" : "") << m.second.bytes / 1024 << " KiB RSS (" << m.second.count << " result(s))" << std::endl;
+    for (const dataElementType& o : objects)
+        std::cout << o.first << ": " << o.second.count << " object(s) (" << o.second.bytes / 1024 << " KiB)" << std::endl;
+    std::cout << "Peak RSS: " << peakRss / 1024 << " KiB" << std::endl;
+}
+
+void TimerResults::addPeakRss(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> l(mResultsSync);
+    mPeakRss = std::max(mPeakRss, bytes);
+}
+
+std::size_t TimerResults::getPeakRss() const
+{
+    std::lock_guard<std::mutex> l(mResultsSync);
+    return std::max(mPeakRss, MemoryUsage::peakRss());
+}
+
+void TimerResults::startMeasurement(const std::string& name)
+{
+    if (!mPhaseListener)
+        return;
+    phases.push_back(name);
+    mPhaseListener(name);
+}
+
+void TimerResults::stopMeasurement(const std::string& name)
+{
+    if (!mPhaseListener)
+        return;
+    // a measurement which was started before the listener was set is not on the stack
+    const auto it = std::find(phases.crbegin(), phases.crend(), name);
+    if (it == phases.crend())
+        return;
+    phases.erase(std::next(it).base());
+    mPhaseListener(phases.empty() ? std::string() : phases.back());
+}
+
+void TimerResults::setTraceContext(std::string file, std::string configuration)
+{
+    traceFile = std::move(file);
+    traceConfiguration = std::move(configuration);
 }
 
+TimerName::TimerName(std::string name)
+    : mName(std::move(name))
+    , mId(TimerResults::getId(mName))
+{}
+
 Timer::Timer(std::string str, TimerResultsIntf* timerResults)
-    : mName(std::move(str))
+    : mOwnedName(std::move(str))
+    , mName(mOwnedName)
     , mResults(timerResults)
+{
+    start();
+}
+
+Timer::Timer(const TimerName& name, TimerResultsIntf* timerResults)
+    : mName(name.name())
+    , mId(name.id())
+    , mResults(timerResults)
+{
+    start();
+}
+
+void Timer::start()
 {
     if (!mResults)
         return;
+    if (mResults->measureMemory())
+        mRss = MemoryUsage::currentRss();
+    if (mResults->measureCounters())
+        mMeasureCounters = PerfCounters::read(mCounters);
+    mResults->startMeasurement(mName);
     mStart = Clock::now();
 }
 
@@ -109,12 +660,43 @@ void Timer::stop()
     if (mStart == TimePoint{})
         return;
 
-    const auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - mStart);
-    mResults->addResults(mName, diff);
+    const TimePoint end = Clock::now();
+    if (mMeasureCounters) {
+        PerfCounters::Values counters;
+        if (PerfCounters::read(counters)) {
+            if (mId != NoId)
+                mResults->addCounters(mId, mName, counters.since(mCounters));
+            else
+                mResults->addCounters(mName, counters.since(mCounters));
+        }
+    }
+    if (mId != NoId)
+        mResults->addResults(mId, mName, end - mStart);
+    else
+        mResults->addResults(mName, end - mStart);
+    mResults->addSpan(mName, mStart.time_since_epoch(), end - mStart);
+    if (mRss != 0)
+        mResults->addMemory(mName, static_cast<std::int64_t>(MemoryUsage::currentRss()) - static_cast<std::int64_t>(mRss));
+    mResults->stopMeasurement(mName);
 
     mStart = TimePoint{}; // prevent multiple stops
 }
 
+TraceSpan::TraceSpan(std::string name, TimerResultsIntf* timerResults)
+    : mName(std::move(name))
+    , mResults(timerResults)
+{
+    if (mResults)
+        mStart = Timer::Clock::now();
+}
+
+TraceSpan::~TraceSpan()
+{
+    if (!mResults)
+        return;
+    mResults->addSpan(mName, mStart.time_since_epoch(), Timer::Clock::now() - mStart);
+}
+
 static std::string durationToString(std::chrono::milliseconds duration)
 {
     // Extract hours
@@ -140,20 +722,39 @@ static std::string durationToString(std::chrono::milliseconds duration)
     return (ellapsedTime + secondsStr + "s");
 }
 
-OneShotTimer::OneShotTimer(std::string name)
+OneShotTimer::OneShotTimer(std::string name, bool counters)
 {
     class MyResults : public TimerResultsIntf
     {
+    public:
+        explicit MyResults(bool counters) : mMeasureCounters(counters) {}
+
     private:
-        void addResults(const std::string &name, std::chrono::milliseconds duration) override
+        using TimerResultsIntf::addResults;
+        using TimerResultsIntf::addCounters;
+
+        void addResults(const std::string &name, std::chrono::nanoseconds duration) override
         {
             std::lock_guard<std::mutex> l(stdCoutLock);
 
             // TODO: do not use std::cout directly
-            std::cout << name << ": " << durationToString(duration) << std::endl;
+            std::cout << name << ": " << durationToString(std::chrono::duration_cast<std::chrono::milliseconds>(duration)) << countersToString(mCounters) << std::endl;
         }
+
+        bool measureCounters() const override
+        {
+            return mMeasureCounters;
+        }
+
+        void addCounters(const std::string& /*name*/, const PerfCounters::Values& counters) override
+        {
+            mCounters = counters;
+        }
+
+        const bool mMeasureCounters;
+        PerfCounters::Values mCounters;
     };
 
-    mResults.reset(new MyResults);
+    mResults.reset(new MyResults(counters));
     mTimer.reset(new Timer(std::move(name), mResults.get()));
 }
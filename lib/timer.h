@@ -21,49 +21,285 @@
 //---------------------------------------------------------------------------
 
 #include "config.h"
+#include "perfcounters.h"
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+/** @brief Aggregated measurements of a single timer */
+struct CPPCHECKLIB TimerStats {
+    std::size_t count{};
+    std::chrono::nanoseconds sum{};
+    std::chrono::nanoseconds min{std::chrono::nanoseconds::max()};
+    std::chrono::nanoseconds max{};
+
+    void add(std::chrono::nanoseconds duration);
+    void merge(const TimerStats& other);
+};
+
 class CPPCHECKLIB TimerResultsIntf {
 public:
+    using Id = std::size_t;
+
     virtual ~TimerResultsIntf() = default;
 
-    virtual void addResults(const std::string& name, std::chrono::milliseconds duration) = 0;
+    virtual void addResults(const std::string& name, std::chrono::nanoseconds duration) = 0;
+
+    /**
+     * @brief Add the result of a timer which has been registered with TimerResults::getId().
+     * @param id       id of the timer
+     * @param name     name of the timer
+     * @param duration duration of the measurement
+     */
+    virtual void addResults(Id id, const std::string& name, std::chrono::nanoseconds duration) {
+        (void)id;
+        addResults(name, duration);
+    }
+
+    /**
+     * @brief Called when a measurement is started - the measurements of a thread might be nested.
+     * @param name name of the measurement
+     */
+    virtual void startMeasurement(const std::string& name) {
+        (void)name;
+    }
+
+    /**
+     * @brief Called when a measurement is stopped. It is called after all other results of the measurement have been added.
+     * @param name name of the measurement
+     */
+    virtual void stopMeasurement(const std::string& name) {
+        (void)name;
+    }
+
+    /**
+     * @brief Called for each measurement with its exact start and duration. Used for tracing.
+     * @param name     name of the measurement
+     * @param start    start time since the clock epoch
+     * @param duration duration of the measurement
+     */
+    virtual void addSpan(const std::string& name, std::chrono::nanoseconds start, std::chrono::nanoseconds duration) {
+        (void)name;
+        (void)start;
+        (void)duration;
+    }
+
+    /** @brief Should the growth of the resident set size be measured as well */
+    virtual bool measureMemory() const {
+        return false;
+    }
+
+    /**
+     * @brief Called for each measurement with the growth of the resident set size if measureMemory() is enabled.
+     * @param name  name of the measurement
+     * @param bytes growth of the resident set size - might be negative
+     */
+    virtual void addMemory(const std::string& name, std::int64_t bytes) {
+        (void)name;
+        (void)bytes;
+    }
+
+    /** @brief Should the hardware performance counters be measured as well */
+    virtual bool measureCounters() const {
+        return false;
+    }
+
+    /**
+     * @brief Called for each measurement with the hardware performance counters if measureCounters() is enabled.
+     * It is called before addResults() for the same measurement.
+     * @param name     name of the measurement
+     * @param counters counted events during the measurement
+     */
+    virtual void addCounters(const std::string& name, const PerfCounters::Values& counters) {
+        (void)name;
+        (void)counters;
+    }
+
+    /** @brief Same as addCounters() for a timer which has been registered with TimerResults::getId() */
+    virtual void addCounters(Id id, const std::string& name, const PerfCounters::Values& counters) {
+        (void)id;
+        addCounters(name, counters);
+    }
+};
+
+/** @brief Aggregated memory measurements */
+struct CPPCHECKLIB MemoryStats {
+    std::size_t count{};
+    std::int64_t bytes{};
 };
 
+/**
+ * @brief Collects the timer measurements.
+ *
+ * Each thread accumulates its measurements and hardware performance counters in its own statistics which are
+ * indexed by a process-wide timer id, so adding a result does not take a lock
+ * and the memory does not grow with the amount of measurements. The statistics
+ * of all threads are merged when the results are queried.
+ */
 class CPPCHECKLIB WARN_UNUSED TimerResults : public TimerResultsIntf {
 public:
-    TimerResults() = default;
+    TimerResults();
+    ~TimerResults() override;
+
+    TimerResults(const TimerResults&) = delete;
+    TimerResults& operator=(const TimerResults&) = delete;
+
+    /** @brief Get the id of the timer with the given name. It is registered on first use. */
+    static Id getId(const std::string& name);
 
     void showResults(size_t max_results = std::numeric_limits<size_t>::max(), bool metrics = true) const;
-    void addResults(const std::string& name, std::chrono::milliseconds duration) override;
+    void addResults(const std::string& name, std::chrono::nanoseconds duration) override;
+    void addResults(Id id, std::chrono::nanoseconds duration);
+    void addResults(Id id, const std::string& name, std::chrono::nanoseconds duration) override;
+
+    /** @brief Add the aggregated results which were measured elsewhere */
+    void addResults(const std::string& name, const TimerStats& stats);
 
     void reset();
 
-    std::map<std::string, std::vector<std::chrono::milliseconds>> getResults() const {
+    std::map<std::string, TimerStats> getResults() const;
+
+    /** @brief The total duration of each timer which has been measured by the current thread */
+    std::map<std::string, std::chrono::nanoseconds> getThreadResults();
+
+    /** @brief Also record every measurement as trace event */
+    void setTrace(bool trace) {
+        mTrace = trace;
+    }
+    void addSpan(const std::string& name, std::chrono::nanoseconds start, std::chrono::nanoseconds duration) override;
+
+    /** @brief Add a trace event which was recorded by another process */
+    void addTraceEvent(std::string event);
+
+    std::vector<std::string> getTraceEvents() const {
         std::lock_guard<std::mutex> l(mResultsSync);
-        return mResults;
+        return mTraceEvents;
+    }
+
+    /** @brief Write the trace events in the Chrome trace event format */
+    void writeTrace(std::ostream& out) const;
+
+    /** @brief Also measure the memory of each measurement */
+    void setMemory(bool memory) {
+        mMemory = memory;
+    }
+    bool measureMemory() const override {
+        return mMemory;
+    }
+    void addMemory(const std::string& name, std::int64_t bytes) override;
+
+    /** @brief Also measure the hardware performance counters of each measurement */
+    void setCounters(bool counters) {
+        mCounters = counters;
+    }
+    bool measureCounters() const override {
+        return mCounters;
+    }
+    void addCounters(const std::string& name, const PerfCounters::Values& counters) override;
+    void addCounters(Id id, const PerfCounters::Values& counters);
+    void addCounters(Id id, const std::string& name, const PerfCounters::Values& counters) override;
+
+    std::map<std::string, PerfCounters::Values> getCounters() const;
+
+    /**
+     * @brief Called with the name of the innermost running measurement of the
+     * calling thread whenever it changes - it is empty when no measurement is running.
+     * It needs to be set before the measurements are started.
+     */
+    using PhaseListener = std::function<void (const std::string& phase)>;
+    void setPhaseListener(PhaseListener listener) {
+        mPhaseListener = std::move(listener);
     }
+    void startMeasurement(const std::string& name) override;
+    void stopMeasurement(const std::string& name) override;
+
+    /** @brief Add the amount and the estimated size of objects which are alive */
+    void addObjects(const std::string& name, std::size_t count, std::size_t size);
+
+    /**
+     * @brief Show the memory measurements of the current thread and the peak
+     * resident set size and reset the memory measurements of the current thread.
+     */
+    void showMemory();
+
+    /** @brief Add the peak resident set size of another process */
+    void addPeakRss(std::size_t bytes);
+
+    /** @brief Peak resident set size of this process and the ones added by addPeakRss() */
+    std::size_t getPeakRss() const;
+
+    /**
+     * @brief Set the file and configuration which the current thread is working on.
+     * They are added to the trace events of this thread.
+     */
+    static void setTraceContext(std::string file, std::string configuration);
+
+private:
+    class Bucket;
+    Bucket& getBucket();
+
+    /** unique serial to identify the object in the thread local cache */
+    const std::uint64_t mSerial;
+
+    /** the statistics of each thread - only written by the owning thread */
+    std::map<std::thread::id, std::unique_ptr<Bucket>> mBuckets;
+
+    /** results which have been added as aggregate or did not fit in the statistics of a thread */
+    std::map<std::string, TimerStats> mResults;
 
-protected:
-    std::map<std::string, std::vector<std::chrono::milliseconds>> mResults;
     mutable std::mutex mResultsSync;
+
+    bool mTrace{};
+    std::vector<std::string> mTraceEvents;
+
+    bool mMemory{};
+    std::size_t mPeakRss{};
+
+    bool mCounters{};
+    /** counters which did not fit in the counters of a thread */
+    std::map<std::string, PerfCounters::Values> mCounterResults;
+
+    PhaseListener mPhaseListener;
+};
+
+/**
+ * @brief Name of a timer which is registered once so its measurements do not need to look up the id.
+ * It is meant to be a static object at the call site.
+ */
+class CPPCHECKLIB TimerName {
+public:
+    explicit TimerName(std::string name);
+
+    const std::string& name() const {
+        return mName;
+    }
+    TimerResults::Id id() const {
+        return mId;
+    }
+
+private:
+    const std::string mName;
+    const TimerResults::Id mId;
 };
 
 class CPPCHECKLIB Timer {
 public:
-    using Clock = std::chrono::high_resolution_clock;
+    using Clock = std::chrono::steady_clock;
     using TimePoint = std::chrono::time_point<Clock>;
 
     explicit Timer(std::string str, TimerResultsIntf* timerResults = nullptr);
+    explicit Timer(const TimerName& name, TimerResultsIntf* timerResults = nullptr);
     ~Timer();
 
     Timer(const Timer&) = delete;
@@ -77,16 +313,53 @@ public:
         f();
     }
 
+    template<class TFunc>
+    static void run(const TimerName& name, TimerResultsIntf* timerResults, const TFunc& f) {
+        Timer t(name, timerResults);
+        f();
+    }
+
 private:
-    const std::string mName;
+    void start();
+
+    static constexpr TimerResults::Id NoId = std::numeric_limits<TimerResults::Id>::max();
+
+    /** only set if the timer has not been constructed with a TimerName */
+    const std::string mOwnedName;
+    const std::string& mName;
+    const TimerResults::Id mId{NoId};
     TimePoint mStart;
+    std::size_t mRss{};
+    bool mMeasureCounters{};
+    PerfCounters::Values mCounters;
+    TimerResultsIntf* mResults{};
+};
+
+/**
+ * @brief Measures a scope for the trace only. It does not show up in the --showtime output.
+ */
+class CPPCHECKLIB TraceSpan {
+public:
+    TraceSpan(std::string name, TimerResultsIntf* timerResults);
+    ~TraceSpan();
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const std::string mName;
+    Timer::TimePoint mStart;
     TimerResultsIntf* mResults{};
 };
 
 class CPPCHECKLIB OneShotTimer
 {
 public:
-    explicit OneShotTimer(std::string name);
+    /**
+     * @param name     name of the measurement
+     * @param counters also show the hardware performance counters
+     */
+    explicit OneShotTimer(std::string name, bool counters = false);
 private:
     std::unique_ptr<TimerResultsIntf> mResults;
     std::unique_ptr<Timer> mTimer;
@@ -67,7 +67,9 @@ Token::Token(const TokenList& tokenlist, std::shared_ptr<TokensFrontBack> tokens
     , mImpl(new Impl)
     , mIsC(mList.isC())
     , mIsCpp(mList.isCPP())
-{}
+{
+    ++mTokensFrontBack->tokens;
+}
 
 Token::Token(const Token* tok)
     : Token(tok->mList, const_cast<Token*>(tok)->mTokensFrontBack)
@@ -78,6 +80,10 @@ Token::Token(const Token* tok)
 
 Token::~Token()
 {
+    --mTokensFrontBack->tokens;
+    // mImpl is null if the data has been taken by another token
+    if (mImpl && mImpl->mValues)
+        mTokensFrontBack->values -= mImpl->mValues->size();
     delete mImpl;
 }
 
@@ -340,6 +346,8 @@ void Token::takeData(Token *fromToken)
     mStr = fromToken->mStr;
     tokType(fromToken->mTokType);
     mFlags = fromToken->mFlags;
+    if (mImpl->mValues)
+        mTokensFrontBack->values -= mImpl->mValues->size();
     delete mImpl;
     mImpl = fromToken->mImpl;
     fromToken->mImpl = nullptr;
@@ -665,7 +673,16 @@ const char *Token::chrInFirstWord(const char *s, char c)
     }
 }
 
+#ifdef CPPCHECK_MATCH_PROFILING
+bool Token::Match(const Token *tok, const char pattern[], nonneg int varid CPPCHECK_MATCH_LOCATION_DEF)
+{
+    CPPCHECK_MATCH_PROFILE(pattern, MatchImpl(tok, pattern, varid));
+}
+
+bool Token::MatchImpl(const Token *tok, const char pattern[], nonneg int varid)
+#else
 bool Token::Match(const Token *tok, const char pattern[], nonneg int varid)
+#endif
 {
     if (!(*pattern))
         return true;
@@ -1023,13 +1040,13 @@ static T *findmatchImpl(T * const startTok, const char pattern[], const nonneg i
     return nullptr;
 }
 
-const Token *Token::findmatch(const Token * const startTok, const char pattern[], const nonneg int varid)
+const Token *Token::findmatch(const Token * const startTok, const char pattern[], const nonneg int varid CPPCHECK_MATCH_LOCATION_DEF)
 {
-    return findmatchImpl(startTok, pattern, varid);
+    CPPCHECK_MATCH_PROFILE(pattern, findmatchImpl(startTok, pattern, varid));
 }
 
-Token *Token::findmatch(Token * const startTok, const char pattern[], const nonneg int varid) {
-    return findmatchImpl(startTok, pattern, varid);
+Token *Token::findmatch(Token * const startTok, const char pattern[], const nonneg int varid CPPCHECK_MATCH_LOCATION_DEF) {
+    CPPCHECK_MATCH_PROFILE(pattern, findmatchImpl(startTok, pattern, varid));
 }
 
 template<class T, REQUIRES("T must be a Token class", std::is_convertible<T*, const Token*> )>
@@ -1042,13 +1059,13 @@ static T *findmatchImpl(T * const startTok, const char pattern[], const Token *
     return nullptr;
 }
 
-const Token *Token::findmatch(const Token * const startTok, const char pattern[], const Token * const end, const nonneg int varid)
+const Token *Token::findmatch(const Token * const startTok, const char pattern[], const Token * const end, const nonneg int varid CPPCHECK_MATCH_LOCATION_DEF)
 {
-    return findmatchImpl(startTok, pattern, end, varid);
+    CPPCHECK_MATCH_PROFILE(pattern, findmatchImpl(startTok, pattern, end, varid));
 }
 
-Token *Token::findmatch(Token * const startTok, const char pattern[], const Token * const end, const nonneg int varid) {
-    return findmatchImpl(startTok, pattern, end, varid);
+Token *Token::findmatch(Token * const startTok, const char pattern[], const Token * const end, const nonneg int varid CPPCHECK_MATCH_LOCATION_DEF) {
+    CPPCHECK_MATCH_PROFILE(pattern, findmatchImpl(startTok, pattern, end, varid));
 }
 
 void Token::function(const Function *f)
@@ -2173,6 +2190,20 @@ static void mergeAdjacent(std::list<ValueFlow::Value>& values)
     }
 }
 
+// Is the impossible value y implied by the impossible bound x? i.e. x is "<= 5" and y is "3" or "<= 3"
+static bool isCoveredByImpossibleBound(const ValueFlow::Value& x, const ValueFlow::Value& y)
+{
+    if (!x.isImpossible() || x.bound == ValueFlow::Value::Bound::Point)
+        return false;
+    if (y.bound != ValueFlow::Value::Bound::Point && y.bound != x.bound)
+        return false;
+    if (x.isSymbolicValue() && !ValueFlow::Value::sameToken(x.tokvalue, y.tokvalue))
+        return false;
+    if (x.bound == ValueFlow::Value::Bound::Upper)
+        return !x.compareValue(y, less{});
+    return !y.compareValue(x, less{});
+}
+
 static void removeOverlaps(std::list<ValueFlow::Value>& values)
 {
     for (const ValueFlow::Value& x : values) {
@@ -2187,7 +2218,9 @@ static void removeOverlaps(std::list<ValueFlow::Value>& values)
                 return false;
             if (x.valueKind != y.valueKind)
                 return false;
-            // TODO: Remove points covered in a lower or upper bound
+            if (isCoveredByImpossibleBound(x, y))
+                return true;
+            // TODO: Remove points covered in a possible lower or upper bound
             // TODO: Remove lower or upper bound already covered by a lower and upper bound
             if (!x.equalValue(y))
                 return false;
@@ -2221,8 +2254,53 @@ static bool sameValueType(const ValueFlow::Value& x, const ValueFlow::Value& y)
     return true;
 }
 
+namespace {
+    /** Keeps the value count of the token list in sync with the values of a token */
+    class ValueCountUpdater {
+    public:
+        ValueCountUpdater(std::list<ValueFlow::Value>* const& values, std::size_t& count)
+            : mValues(values)
+            , mCount(count)
+            , mOldSize(values ? values->size() : 0)
+        {}
+        ~ValueCountUpdater() {
+            mCount -= mOldSize;
+            if (mValues)
+                mCount += mValues->size();
+        }
+
+        ValueCountUpdater(const ValueCountUpdater&) = delete;
+        ValueCountUpdater& operator=(const ValueCountUpdater&) = delete;
+
+    private:
+        std::list<ValueFlow::Value>* const& mValues;
+        std::size_t& mCount;
+        const std::size_t mOldSize;
+    };
+}
+
+void Token::removeValues(std::function<bool(const ValueFlow::Value &)> pred)
+{
+    if (!mImpl->mValues)
+        return;
+    const std::size_t oldSize = mImpl->mValues->size();
+    mImpl->mValues->remove_if(std::move(pred));
+    mTokensFrontBack->values -= oldSize - mImpl->mValues->size();
+}
+
+void Token::clearValueFlow()
+{
+    if (!mImpl->mValues)
+        return;
+    mTokensFrontBack->values -= mImpl->mValues->size();
+    delete mImpl->mValues;
+    mImpl->mValues = nullptr;
+}
+
 bool Token::addValue(const ValueFlow::Value &value)
 {
+    const ValueCountUpdater countUpdater(mImpl->mValues, mTokensFrontBack->values);
+
     if (value.isKnown() && mImpl->mValues) {
         // Clear all other values of the same type since value is known
         mImpl->mValues->remove_if([&](const ValueFlow::Value& x) {
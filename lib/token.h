@@ -23,6 +23,7 @@
 
 #include "config.h"
 #include "errortypes.h"
+#include "matchprofiler.h"
 #include "mathlib.h"
 #include "smallvector.h"
 #include "templatesimplifier.h"
@@ -213,7 +214,7 @@ public:
 
     template<typename T>
     void str(T&& s) {
-        mStr = s;
+        mStr = std::forward<T>(s);
         mImpl->mVarId = 0;
 
         update_property_info();
@@ -301,8 +302,8 @@ public:
      *         false if given token does not match with given pattern
      */
     template<size_t count>
-    static bool simpleMatch(const Token *tok, const char (&pattern)[count]) {
-        return simpleMatch(tok, pattern, count-1);
+    static bool simpleMatch(const Token *tok, const char (&pattern)[count] CPPCHECK_MATCH_LOCATION) {
+        CPPCHECK_MATCH_PROFILE(pattern, simpleMatch(tok, pattern, count-1));
     }
 
     static bool simpleMatch(const Token *tok, const char pattern[], size_t pattern_len);
@@ -350,7 +351,7 @@ public:
      * @return true if given token matches with given pattern
      *         false if given token does not match with given pattern
      */
-    static bool Match(const Token *tok, const char pattern[], nonneg int varid = 0);
+    static bool Match(const Token *tok, const char pattern[], nonneg int varid = 0 CPPCHECK_MATCH_LOCATION);
 
     /**
      * @return length of C-string.
@@ -861,35 +862,39 @@ public:
     }
 
     template<size_t count>
-    static const Token *findsimplematch(const Token * const startTok, const char (&pattern)[count]) {
-        return findsimplematch(startTok, pattern, count-1);
+    static const Token *findsimplematch(const Token * const startTok, const char (&pattern)[count] CPPCHECK_MATCH_LOCATION) {
+        CPPCHECK_MATCH_PROFILE(pattern, findsimplematch(startTok, pattern, count-1));
     }
     static const Token *findsimplematch(const Token * startTok, const char pattern[], size_t pattern_len);
 
     template<size_t count>
-    static const Token *findsimplematch(const Token * const startTok, const char (&pattern)[count], const Token * const end) {
-        return findsimplematch(startTok, pattern, count-1, end);
+    static const Token *findsimplematch(const Token * const startTok, const char (&pattern)[count], const Token * const end CPPCHECK_MATCH_LOCATION) {
+        CPPCHECK_MATCH_PROFILE(pattern, findsimplematch(startTok, pattern, count-1, end));
     }
     static const Token *findsimplematch(const Token * startTok, const char pattern[], size_t pattern_len, const Token * end);
 
-    static const Token *findmatch(const Token * startTok, const char pattern[], nonneg int varid = 0);
-    static const Token *findmatch(const Token * startTok, const char pattern[], const Token * end, nonneg int varid = 0);
+    static const Token *findmatch(const Token * startTok, const char pattern[], nonneg int varid = 0 CPPCHECK_MATCH_LOCATION);
+    static const Token *findmatch(const Token * startTok, const char pattern[], const Token * end, nonneg int varid = 0 CPPCHECK_MATCH_LOCATION);
 
     template<size_t count>
-    static Token *findsimplematch(Token * const startTok, const char (&pattern)[count]) {
-        return findsimplematch(startTok, pattern, count-1);
+    static Token *findsimplematch(Token * const startTok, const char (&pattern)[count] CPPCHECK_MATCH_LOCATION) {
+        CPPCHECK_MATCH_PROFILE(pattern, findsimplematch(startTok, pattern, count-1));
     }
     static Token *findsimplematch(Token * startTok, const char pattern[], size_t pattern_len);
     template<size_t count>
-    static Token *findsimplematch(Token * const startTok, const char (&pattern)[count], const Token * const end) {
-        return findsimplematch(startTok, pattern, count-1, end);
+    static Token *findsimplematch(Token * const startTok, const char (&pattern)[count], const Token * const end CPPCHECK_MATCH_LOCATION) {
+        CPPCHECK_MATCH_PROFILE(pattern, findsimplematch(startTok, pattern, count-1, end));
     }
     static Token *findsimplematch(Token * startTok, const char pattern[], size_t pattern_len, const Token * end);
 
-    static Token *findmatch(Token * startTok, const char pattern[], nonneg int varid = 0);
-    static Token *findmatch(Token * startTok, const char pattern[], const Token * end, nonneg int varid = 0);
+    static Token *findmatch(Token * startTok, const char pattern[], nonneg int varid = 0 CPPCHECK_MATCH_LOCATION);
+    static Token *findmatch(Token * startTok, const char pattern[], const Token * end, nonneg int varid = 0 CPPCHECK_MATCH_LOCATION);
 
 private:
+#ifdef CPPCHECK_MATCH_PROFILING
+    static bool MatchImpl(const Token *tok, const char pattern[], nonneg int varid);
+#endif
+
     template<class T, REQUIRES("T must be a Token class", std::is_convertible<T*, const Token*> )>
     static T *tokAtImpl(T *tok, int index)
     {
@@ -1413,10 +1418,7 @@ public:
     /** Add token value. Return true if value is added. */
     bool addValue(const ValueFlow::Value &value);
 
-    void removeValues(std::function<bool(const ValueFlow::Value &)> pred) {
-        if (mImpl->mValues)
-            mImpl->mValues->remove_if(std::move(pred));
-    }
+    void removeValues(std::function<bool(const ValueFlow::Value &)> pred);
 
     nonneg int index() const {
         return mImpl->mIndex;
@@ -1638,10 +1640,7 @@ public:
      */
     bool isCalculation() const;
 
-    void clearValueFlow() {
-        delete mImpl->mValues;
-        mImpl->mValues = nullptr;
-    }
+    void clearValueFlow();
 
     // cppcheck-suppress unusedFunction - used in tests only
     std::string astString(const char *sep = "") const {
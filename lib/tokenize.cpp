@@ -1191,9 +1191,19 @@ void Tokenizer::simplifyTypedefCpp()
     // add global namespace
     std::vector<Space> spaceInfo(1);
 
-    const std::time_t maxTime = mSettings.typedefMaxTime > 0 ? std::time(nullptr) + mSettings.typedefMaxTime: 0;
+    const std::time_t startTime = std::time(nullptr);
+    const std::time_t maxTime = mSettings.typedefMaxTime > 0 ? startTime + mSettings.typedefMaxTime: 0;
+    std::size_t typedefCount = 0;
     ProgressReporter progressReporter(mErrorLogger, mSettings.reportProgress, list.getSourceFilePath(), "Tokenize (typedef)");
 
+    // Number of name tokens with a given name. Tokens inserted by the simplification are
+    // copies of existing names so the count is never lower than the real number of uses.
+    std::unordered_map<std::string, int> nameCount;
+    for (const Token *tok = list.front(); tok; tok = tok->next()) {
+        if (tok->isName())
+            ++nameCount[tok->str()];
+    }
+
     for (Token *tok = list.front(); tok; tok = tok->next()) {
         progressReporter.report(tok->progressValue());
 
@@ -1201,6 +1211,8 @@ void Tokenizer::simplifyTypedefCpp()
             return;
 
         if (maxTime > 0 && std::time(nullptr) > maxTime) {
+            if (!mSettings.limitsReportFile.empty())
+                mErrorLogger.reportLimit(list.getSourceFilePath(), "", "typedefMaxTime", mSettings.typedefMaxTime, typedefCount, (std::time(nullptr) - startTime) * 1000);
             if (mSettings.debugwarnings) {
                 ErrorMessage::FileLocation loc(list.getFiles()[0], 0, 0);
                 ErrorMessage errmsg({std::move(loc)},
@@ -1255,6 +1267,8 @@ void Tokenizer::simplifyTypedefCpp()
             continue;
         }
 
+        ++typedefCount;
+
         // pull struct, union, enum or class definition out of typedef
         // use typedef name for unnamed struct, union, enum or class
         const Token* tokClass = tok->next();
@@ -1265,6 +1279,11 @@ void Tokenizer::simplifyTypedefCpp()
             if (!tok1)
                 continue;
             tok = tok1;
+            // the split inserts the (possibly generated) type name
+            for (const Token *tok2 = tok; tok2 && tok2->str() != ";"; tok2 = tok2->next()) {
+                if (tok2->isName())
+                    ++nameCount[tok2->str()];
+            }
         }
 
         /** @todo add support for union */
@@ -1705,7 +1724,10 @@ void Tokenizer::simplifyTypedefCpp()
                 classPath += spaceInfo[i].className;
             }
 
-            for (Token *tok2 = tok; tok2; tok2 = tok2->next()) {
+            // don't scan the rest of the code if the name only occurs in the typedef itself
+            const bool hasUses = nameCount[typeName->str()] > 1;
+
+            for (Token *tok2 = hasUses ? tok : nullptr; tok2; tok2 = tok2->next()) {
                 if (Settings::terminated())
                     return;
 
@@ -3513,7 +3535,8 @@ bool Tokenizer::simplifyTokens1(const std::string &configuration, int fileIndex)
     mConfiguration = configuration;
 
     if (mTimerResults) {
-        Timer t("Tokenizer::simplifyTokens1::simplifyTokenList1", mTimerResults);
+        static const TimerName simplifyTokenList1Timer("Tokenizer::simplifyTokens1::simplifyTokenList1");
+        Timer t(simplifyTokenList1Timer, mTimerResults);
         if (!simplifyTokenList1(list.getFiles().front().c_str()))
             return false;
     } else {
@@ -3521,16 +3544,19 @@ bool Tokenizer::simplifyTokens1(const std::string &configuration, int fileIndex)
             return false;
     }
 
-    Timer::run("Tokenizer::simplifyTokens1::createAst", mTimerResults, [&]() {
+    static const TimerName createAstTimer("Tokenizer::simplifyTokens1::createAst");
+    Timer::run(createAstTimer, mTimerResults, [&]() {
         list.createAst();
         list.validateAst(mSettings.debugnormal);
     });
 
-    Timer::run("Tokenizer::simplifyTokens1::createSymbolDatabase", mTimerResults, [&]() {
+    static const TimerName createSymbolDatabaseTimer("Tokenizer::simplifyTokens1::createSymbolDatabase");
+    Timer::run(createSymbolDatabaseTimer, mTimerResults, [&]() {
         createSymbolDatabase();
     });
 
-    Timer::run("Tokenizer::simplifyTokens1::setValueType", mTimerResults, [&]() {
+    static const TimerName setValueTypeTimer("Tokenizer::simplifyTokens1::setValueType");
+    Timer::run(setValueTypeTimer, mTimerResults, [&]() {
         mSymbolDatabase->setValueTypeInTokenList(false);
         mSymbolDatabase->setValueTypeInTokenList(true);
     });
@@ -3539,13 +3565,13 @@ bool Tokenizer::simplifyTokens1(const std::string &configuration, int fileIndex)
         Summaries::create(*this, configuration, fileIndex);
 
     // TODO: apply this through Settings::ValueFlowOptions
-    // TODO: do not run valueflow if no checks are being performed at all - e.g. unusedFunctions only
     // TODO: log message when this is active?
     const char* disableValueflowEnv = std::getenv("DISABLE_VALUEFLOW");
-    const bool doValueFlow = !disableValueflowEnv || (std::strcmp(disableValueflowEnv, "1") != 0);
+    const bool doValueFlow = (!disableValueflowEnv || (std::strcmp(disableValueflowEnv, "1") != 0)) && isValueFlowNeeded();
 
     if (doValueFlow) {
-        Timer::run("Tokenizer::simplifyTokens1::ValueFlow", mTimerResults, [&]() {
+        static const TimerName valueFlowTimer("Tokenizer::simplifyTokens1::ValueFlow");
+        Timer::run(valueFlowTimer, mTimerResults, [&]() {
             ValueFlow::setValues(list, *mSymbolDatabase, mErrorLogger, mSettings, mTimerResults);
         });
 
@@ -3576,6 +3602,22 @@ bool Tokenizer::simplifyTokens1(const std::string &configuration, int fileIndex)
 
 //---------------------------------------------------------------------------
 
+bool Tokenizer::isValueFlowNeeded() const
+{
+    // the values are written to the dump file which is also used by the addons
+    if (mSettings.dump || !mSettings.addons.empty())
+        return true;
+    // the values are shown in the debug output
+    if (mSettings.debugnormal || mSettings.debugvalueflow)
+        return true;
+    // the checks with the "error" severity cannot be disabled so they always use the values unless
+    // no checks besides unusedFunction are performed - unusedFunction does not use any values
+    // TODO: this should actually be the behavior if only "--enable=unusedFunction" is specified - see #10648
+    return !Settings::unusedFunctionOnly();
+}
+
+//---------------------------------------------------------------------------
+
 void Tokenizer::findComplicatedSyntaxErrorsInTemplates()
 {
     validate();
@@ -5110,6 +5152,44 @@ namespace {
         std::list<std::string> scope;
         Token *tok;
     };
+
+    /** Members by the names of the scopes they can belong to */
+    using MemberIndex = std::unordered_map<std::string, std::vector<const Member *>>;
+}
+
+/**
+ * Add member to the index. The member is added for all names that matchMemberName()
+ * could compare with the innermost scope: the names of the current namespaces, the
+ * names of the used namespaces and the qualification of the member.
+ */
+static void addMemberToIndex(const Member &member, MemberIndex &index)
+{
+    std::set<std::string> names(member.scope.cbegin(), member.scope.cend());
+    for (const Token *ns : member.usingnamespaces) {
+        while (Token::Match(ns, "%name% ::|;")) {
+            names.insert(ns->str());
+            ns = ns->tokAt(2);
+        }
+    }
+    const Token *tok = member.tok;
+    while (Token::Match(tok, "%name% ::|<")) {
+        names.insert(tok->str());
+        if (tok->strAt(1) == "<") {
+            tok = tok->next()->findClosingBracket();
+            if (!Token::simpleMatch(tok, "> ::"))
+                break;
+        }
+        tok = tok->tokAt(2);
+    }
+    for (const std::string &name : names)
+        index[name].push_back(&member);
+}
+
+static const std::vector<const Member *> &getIndexedMembers(const MemberIndex &index, const std::string &scopeName)
+{
+    static const std::vector<const Member *> none;
+    const auto it = index.find(scopeName);
+    return it == index.end() ? none : it->second;
 }
 
 static std::string getScopeName(const std::list<ScopeInfo2> &scopeInfo)
@@ -5287,6 +5367,14 @@ void Tokenizer::setVarIdPass2()
         }
     }
 
+    // Only look at the members that can belong to a class, instead of all members for each class
+    MemberIndex memberFunctionIndex;
+    for (const Member &func : allMemberFunctions)
+        addMemberToIndex(func, memberFunctionIndex);
+    MemberIndex memberVarIndex;
+    for (const Member &var : allMemberVars)
+        addMemberToIndex(var, memberVarIndex);
+
     std::list<ScopeInfo2> scopeInfo;
 
     // class members..
@@ -5403,8 +5491,8 @@ void Tokenizer::setVarIdPass2()
             continue;
 
         // Member variables
-        for (const Member &var : allMemberVars) {
-            Token *tok2 = matchMemberVarName(var, scopeInfo);
+        for (const Member *var : getIndexedMembers(memberVarIndex, scopeInfo.back().name)) {
+            Token *tok2 = matchMemberVarName(*var, scopeInfo);
             if (!tok2)
                 continue;
             if (tok2->varId() == 0)
@@ -5415,8 +5503,8 @@ void Tokenizer::setVarIdPass2()
             continue;
 
         // Set variable ids in member functions for this class..
-        for (const Member &func : allMemberFunctions) {
-            Token *tok2 = matchMemberFunctionName(func, scopeInfo);
+        for (const Member *func : getIndexedMembers(memberFunctionIndex, scopeInfo.back().name)) {
+            Token *tok2 = matchMemberFunctionName(*func, scopeInfo);
             if (!tok2)
                 continue;
 
@@ -5757,7 +5845,8 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     validate();
 
     // Bail out if code is garbage
-    Timer::run("Tokenizer::simplifyTokens1::simplifyTokenList1::findGarbageCode", mTimerResults, [&]() {
+    static const TimerName findGarbageCodeTimer("Tokenizer::simplifyTokens1::simplifyTokenList1::findGarbageCode");
+    Timer::run(findGarbageCodeTimer, mTimerResults, [&]() {
         findGarbageCode();
     });
 
@@ -5797,23 +5886,22 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     sizeofAddParentheses();
 
     // Simplify: 0[foo] -> *(foo)
-    for (Token* tok = list.front(); tok; tok = tok->next()) {
-        if (Token::simpleMatch(tok, "0 [") && tok->linkAt(1)) {
-            tok->str("*");
-            tok->next()->str("(");
-            tok->linkAt(1)->str(")");
-        }
-    }
-
-    if (Settings::terminated())
-        return false;
-
-    validate();
-
-    // simplify simple calculations inside <..>
-    if (isCPP()) {
+    // and simple calculations inside <..>
+    // Both rewrites are local so they are done in the same pass.
+    static const TimerName simplifyArrayIndexAndTemplateArgumentsTimer("Tokenizer::simplifyTokens1::simplifyTokenList1::simplifyArrayIndexAndTemplateArguments");
+    Timer::run(simplifyArrayIndexAndTemplateArgumentsTimer, mTimerResults, [&]() {
+        const bool cpp = isCPP();
         Token *lt = nullptr;
         for (Token *tok = list.front(); tok; tok = tok->next()) {
+            if (Token::simpleMatch(tok, "0 [") && tok->linkAt(1)) {
+                tok->str("*");
+                tok->next()->str("(");
+                tok->linkAt(1)->str(")");
+            }
+
+            if (!cpp)
+                continue;
+
             if (Token::Match(tok, "[;{}]"))
                 lt = nullptr;
             else if (Token::Match(tok, "%type% <"))
@@ -5827,7 +5915,12 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
                 lt = tok->next();
             }
         }
-    }
+    });
+
+    if (Settings::terminated())
+        return false;
+
+    validate();
 
     // Convert K&R function declarations to modern C
     simplifyVarDecl(true);
@@ -5865,11 +5958,11 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     // remove unnecessary member qualification..
     removeUnnecessaryQualification();
 
-    // convert Microsoft memory functions
-    simplifyMicrosoftMemoryFunctions();
-
-    // convert Microsoft string functions
-    simplifyMicrosoftStringFunctions();
+    // convert Microsoft memory and string functions
+    static const TimerName simplifyMicrosoftFunctionsTimer("Tokenizer::simplifyTokens1::simplifyTokenList1::simplifyMicrosoftFunctions");
+    Timer::run(simplifyMicrosoftFunctionsTimer, mTimerResults, [&]() {
+        simplifyMicrosoftFunctions();
+    });
 
     if (Settings::terminated())
         return false;
@@ -5894,7 +5987,8 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     simplifyTypedefLHS();
 
     // typedef..
-    Timer::run("Tokenizer::simplifyTokens1::simplifyTokenList1::simplifyTypedef", mTimerResults, [&]() {
+    static const TimerName simplifyTypedefTimer("Tokenizer::simplifyTokens1::simplifyTokenList1::simplifyTypedef");
+    Timer::run(simplifyTypedefTimer, mTimerResults, [&]() {
         simplifyTypedef();
     });
 
@@ -5988,7 +6082,8 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
         simplifyTypeIntrinsics();
 
         // Handle templates..
-        Timer::run("Tokenizer::simplifyTokens1::simplifyTokenList1::simplifyTemplates", mTimerResults, [&]() {
+        static const TimerName simplifyTemplatesTimer("Tokenizer::simplifyTokens1::simplifyTokenList1::simplifyTemplates");
+        Timer::run(simplifyTemplatesTimer, mTimerResults, [&]() {
             simplifyTemplates();
         });
 
@@ -6015,7 +6110,8 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
 
     validate(); // #6772 "segmentation fault (invalid code) in Tokenizer::setVarId"
 
-    Timer::run("Tokenizer::simplifyTokens1::simplifyTokenList1::setVarId", mTimerResults, [&](){
+    static const TimerName setVarIdTimer("Tokenizer::simplifyTokens1::simplifyTokenList1::setVarId");
+    Timer::run(setVarIdTimer, mTimerResults, [&](){
         setVarId();
     });
 
@@ -10407,56 +10503,65 @@ void Tokenizer::simplifyNamespaceStd()
 }
 
 
-void Tokenizer::simplifyMicrosoftMemoryFunctions()
+void Tokenizer::simplifyMicrosoftFunctions()
 {
     // skip if not Windows
     if (!mSettings.platform.isWindows())
         return;
 
+    // The memory and string function rewrites only change the function call at hand,
+    // so both are done in the same pass over the token list.
+    const bool ansi = (mSettings.platform.type == Platform::Type::Win32A); // TODO: check for UNICODE define instead
     for (Token *tok = list.front(); tok; tok = tok->next()) {
         if (tok->strAt(1) != "(")
             continue;
 
-        if (Token::Match(tok, "CopyMemory|RtlCopyMemory|RtlCopyBytes")) {
-            tok->str("memcpy");
-        } else if (Token::Match(tok, "MoveMemory|RtlMoveMemory")) {
-            tok->str("memmove");
-        } else if (Token::Match(tok, "FillMemory|RtlFillMemory|RtlFillBytes")) {
-            // FillMemory(dst, len, val) -> memset(dst, val, len)
-            tok->str("memset");
+        simplifyMicrosoftMemoryFunction(tok);
+        simplifyMicrosoftStringFunction(tok, ansi);
+    }
+}
+
+void Tokenizer::simplifyMicrosoftMemoryFunction(Token *tok)
+{
+    if (Token::Match(tok, "CopyMemory|RtlCopyMemory|RtlCopyBytes")) {
+        tok->str("memcpy");
+    } else if (Token::Match(tok, "MoveMemory|RtlMoveMemory")) {
+        tok->str("memmove");
+    } else if (Token::Match(tok, "FillMemory|RtlFillMemory|RtlFillBytes")) {
+        // FillMemory(dst, len, val) -> memset(dst, val, len)
+        tok->str("memset");
 
-            Token *tok1 = tok->tokAt(2);
-            if (tok1)
-                tok1 = tok1->nextArgument(); // Second argument
-            if (tok1) {
-                Token *tok2 = tok1->nextArgument(); // Third argument
+        Token *tok1 = tok->tokAt(2);
+        if (tok1)
+            tok1 = tok1->nextArgument(); // Second argument
+        if (tok1) {
+            Token *tok2 = tok1->nextArgument(); // Third argument
 
-                if (tok2)
-                    Token::move(tok1->previous(), tok2->tokAt(-2), tok->linkAt(1)->previous()); // Swap third with second argument
-            }
-        } else if (Token::Match(tok, "ZeroMemory|RtlZeroMemory|RtlZeroBytes|RtlSecureZeroMemory")) {
-            // ZeroMemory(dst, len) -> memset(dst, 0, len)
-            tok->str("memset");
+            if (tok2)
+                Token::move(tok1->previous(), tok2->tokAt(-2), tok->linkAt(1)->previous()); // Swap third with second argument
+        }
+    } else if (Token::Match(tok, "ZeroMemory|RtlZeroMemory|RtlZeroBytes|RtlSecureZeroMemory")) {
+        // ZeroMemory(dst, len) -> memset(dst, 0, len)
+        tok->str("memset");
 
-            Token *tok1 = tok->tokAt(2);
-            if (tok1)
-                tok1 = tok1->nextArgument(); // Second argument
+        Token *tok1 = tok->tokAt(2);
+        if (tok1)
+            tok1 = tok1->nextArgument(); // Second argument
 
-            if (tok1) {
-                tok1 = tok1->previous();
-                tok1->insertToken("0");
-                tok1 = tok1->next();
-                tok1->insertToken(",");
-            }
-        } else if (Token::simpleMatch(tok, "RtlCompareMemory")) {
-            // RtlCompareMemory(src1, src2, len) -> memcmp(src1, src2, len)
-            tok->str("memcmp");
-            // For the record, when memcmp returns 0, both strings are equal.
-            // When RtlCompareMemory returns len, both strings are equal.
-            // It might be needed to improve this replacement by something
-            // like ((len - memcmp(src1, src2, len)) % (len + 1)) to
-            // respect execution path (if required)
+        if (tok1) {
+            tok1 = tok1->previous();
+            tok1->insertToken("0");
+            tok1 = tok1->next();
+            tok1->insertToken(",");
         }
+    } else if (Token::simpleMatch(tok, "RtlCompareMemory")) {
+        // RtlCompareMemory(src1, src2, len) -> memcmp(src1, src2, len)
+        tok->str("memcmp");
+        // For the record, when memcmp returns 0, both strings are equal.
+        // When RtlCompareMemory returns len, both strings are equal.
+        // It might be needed to improve this replacement by something
+        // like ((len - memcmp(src1, src2, len)) % (len + 1)) to
+        // respect execution path (if required)
     }
 }
 
@@ -10502,37 +10607,27 @@ namespace {
     };
 }
 
-void Tokenizer::simplifyMicrosoftStringFunctions()
+void Tokenizer::simplifyMicrosoftStringFunction(Token *tok, bool ansi)
 {
-    // skip if not Windows
-    if (!mSettings.platform.isWindows())
-        return;
-
-    const bool ansi = (mSettings.platform.type == Platform::Type::Win32A); // TODO: check for UNICODE define instead
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        if (tok->strAt(1) != "(")
-            continue;
-
-        const auto match = apis.find(tok->str());
-        if (match!=apis.end()) {
-            tok->str(ansi ? match->second.mbcs : match->second.unicode);
-            tok->originalName(match->first);
-        } else if (Token::Match(tok, "_T|_TEXT|TEXT ( %char%|%str% )")) {
-            tok->deleteNext();
-            tok->deleteThis();
+    const auto match = apis.find(tok->str());
+    if (match!=apis.end()) {
+        tok->str(ansi ? match->second.mbcs : match->second.unicode);
+        tok->originalName(match->first);
+    } else if (Token::Match(tok, "_T|_TEXT|TEXT ( %char%|%str% )")) {
+        tok->deleteNext();
+        tok->deleteThis();
+        tok->deleteNext();
+        if (!ansi) {
+            tok->isLong(true);
+            if (tok->str()[0] != 'L')
+                tok->str("L" + tok->str());
+        }
+        while (Token::Match(tok->next(), "_T|_TEXT|TEXT ( %char%|%str% )")) {
+            tok->next()->deleteNext();
+            tok->next()->deleteThis();
+            tok->next()->deleteNext();
+            tok->concatStr(tok->strAt(1));
             tok->deleteNext();
-            if (!ansi) {
-                tok->isLong(true);
-                if (tok->str()[0] != 'L')
-                    tok->str("L" + tok->str());
-            }
-            while (Token::Match(tok->next(), "_T|_TEXT|TEXT ( %char%|%str% )")) {
-                tok->next()->deleteNext();
-                tok->next()->deleteThis();
-                tok->next()->deleteNext();
-                tok->concatStr(tok->strAt(1));
-                tok->deleteNext();
-            }
         }
     }
 }
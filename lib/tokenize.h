@@ -136,6 +136,9 @@ private:
     void arraySize();
     void arraySizeAfterValueFlow();
 
+    /** Are ValueFlow values used by the checks, written to the dump file or shown in the debug output? */
+    bool isValueFlowNeeded() const;
+
     /** Simplify labels and 'case|default' syntaxes.
      */
     void simplifyLabelsCaseDefault();
@@ -490,19 +493,24 @@ private:
     void simplifyNamespaceStd();
 
     /**
-     * Convert Microsoft memory functions
+     * Convert Microsoft memory and string functions in a single pass
+     */
+    void simplifyMicrosoftFunctions();
+
+    /**
+     * Convert Microsoft memory function
      * CopyMemory(dst, src, len) -> memcpy(dst, src, len)
      * FillMemory(dst, len, val) -> memset(dst, val, len)
      * MoveMemory(dst, src, len) -> memmove(dst, src, len)
      * ZeroMemory(dst, len) -> memset(dst, 0, len)
      */
-    void simplifyMicrosoftMemoryFunctions();
+    static void simplifyMicrosoftMemoryFunction(Token *tok);
 
     /**
-     * Convert Microsoft string functions
+     * Convert Microsoft string function
      * _tcscpy -> strcpy
      */
-    void simplifyMicrosoftStringFunctions();
+    static void simplifyMicrosoftStringFunction(Token *tok, bool ansi);
 
     /**
      * Remove Borland code
@@ -43,6 +43,7 @@
 #include <set>
 #include <stack>
 #include <unordered_set>
+#include <vector>
 
 #include <simplecpp.h>
 
@@ -382,11 +383,7 @@ void TokenList::createTokens(simplecpp::TokenList&& tokenList)
     for (const simplecpp::Token *tok = tokenList.cfront(); tok;) {
 
         // TODO: move from TokenList
-        std::string str = tok->str();
-
-        // Float literal
-        if (str.size() > 1 && str[0] == '.' && std::isdigit(str[1]))
-            str = '0' + str;
+        const std::string &str = tok->str();
 
         if (mTokensFrontBack->back) {
             mTokensFrontBack->back->insertToken(str);
@@ -396,6 +393,10 @@ void TokenList::createTokens(simplecpp::TokenList&& tokenList)
             mTokensFrontBack->back->str(str);
         }
 
+        // Float literal
+        if (str.size() > 1 && str[0] == '.' && std::isdigit(str[1]))
+            mTokensFrontBack->back->str('0' + str);
+
         mTokensFrontBack->back->fileIndex(tok->location.fileIndex);
         mTokensFrontBack->back->linenr(tok->location.line);
         mTokensFrontBack->back->column(tok->location.col);
@@ -435,7 +436,7 @@ std::size_t TokenList::calculateHash() const
 
 namespace {
     struct AST_state {
-        std::stack<Token*> op;
+        std::stack<Token*, std::vector<Token*>> op;
         int depth{};
         int inArrayAssignment{};
         bool cpp;
@@ -1465,6 +1466,51 @@ static void compileComma(Token *&tok, AST_state& state)
     }
 }
 
+static bool isPlainLiteral(const Token* tok)
+{
+    return tok->isNumber() || tok->tokType() == Token::eString || tok->tokType() == Token::eChar;
+}
+
+/**
+ * Compile a "{ literal, literal, .. }" initializer list such as a generated data table
+ * directly into a comma chain. The result is the same as for compileComma() but each
+ * element does not need to go through all precedence levels.
+ * @return false if the list contains anything else than literals
+ */
+static bool compileLiteralList(Token *&tok, AST_state& state)
+{
+    if (state.inGeneric || !Token::simpleMatch(tok->previous(), "{") || !Token::simpleMatch(tok->next(), ","))
+        return false;
+    const Token * const end = tok->previous()->link();
+    if (!end)
+        return false;
+    for (const Token *tok2 = tok; tok2 != end; tok2 = tok2->tokAt(2)) {
+        if (!isPlainLiteral(tok2))
+            return false;
+        if (tok2->next() == end)
+            break;
+        if (tok2->strAt(1) != ",")
+            return false;
+        if (tok2->tokAt(2) == end)
+            break;
+    }
+    state.op.push(tok);
+    tok = tok->next();
+    while (tok != end) {
+        if (tok->next() == end) {
+            tok = tok->next();
+            break;
+        }
+        Token * const comma = tok;
+        comma->astOperand2(comma->next());
+        comma->astOperand1(state.op.top());
+        state.op.pop();
+        state.op.push(comma);
+        tok = comma->tokAt(2);
+    }
+    return true;
+}
+
 /**
  * @throws InternalError thrown if maximum AST depth is exceeded
  */
@@ -1472,7 +1518,7 @@ static void compileExpression(Token *&tok, AST_state& state)
 {
     if (state.depth > AST_MAX_DEPTH)
         throw InternalError(tok, "maximum AST depth exceeded", InternalError::AST); // ticket #5592
-    if (tok)
+    if (tok && !compileLiteralList(tok, state))
         compileComma(tok, state);
 }
 
@@ -46,6 +46,10 @@ namespace simplecpp {
 struct TokensFrontBack {
     Token *front{};
     Token* back{};
+    /** number of tokens which have been created for the list and not been deleted yet */
+    std::size_t tokens{};
+    /** number of ValueFlow values stored in the tokens of the list */
+    std::size_t values{};
 };
 
 class CPPCHECKLIB TokenList {
@@ -135,6 +139,16 @@ public:
         return mTokensFrontBack->back;
     }
 
+    /** get number of tokens in the list - this includes temporary tokens created for the list */
+    std::size_t getTokenCount() const {
+        return mTokensFrontBack->tokens;
+    }
+
+    /** get total number of ValueFlow values of all tokens in the list */
+    std::size_t getValueCount() const {
+        return mTokensFrontBack->values;
+    }
+
     /**
      * Get filenames (the sourcefile + the files it include).
      * The first filename is the filename for the sourcefile
@@ -5420,8 +5420,10 @@ static void valueFlowForLoop(const TokenList &tokenlist, const SymbolDatabase& s
     }
 }
 
+// Returns the number of argument combinations. When it exceeds maxSubFunctionArgs only that many
+// combinations are analyzed and the combinations are not counted any further.
 template<class Key, class F>
-static bool productParams(const Settings& settings, const std::unordered_map<Key, std::list<ValueFlow::Value>>& vars, F f)
+static std::size_t productParams(const Settings& settings, const std::unordered_map<Key, std::list<ValueFlow::Value>>& vars, F f)
 {
     using Args = std::vector<std::unordered_map<Key, ValueFlow::Value>>;
     Args args(1);
@@ -5431,13 +5433,10 @@ static bool productParams(const Settings& settings, const std::unordered_map<Key
             continue;
         args.back()[p.first] = p.second.front();
     }
-    bool bail = false;
     int max = settings.vfOptions.maxSubFunctionArgs;
     for (const auto& p : vars) {
-        if (args.size() > max) {
-            bail = true;
+        if (args.size() > max)
             break;
-        }
         if (p.second.empty())
             continue;
         std::for_each(std::next(p.second.begin()), p.second.end(), [&](const ValueFlow::Value& value) {
@@ -5460,8 +5459,8 @@ static bool productParams(const Settings& settings, const std::unordered_map<Key
         });
     }
 
+    const std::size_t combinations = args.size();
     if (args.size() > max) {
-        bail = true;
         args.resize(max);
         // TODO: add bailout message
     }
@@ -5477,7 +5476,7 @@ static bool productParams(const Settings& settings, const std::unordered_map<Key
             continue;
         f(arg);
     }
-    return !bail;
+    return combinations;
 }
 
 static void valueFlowInjectParameter(const TokenList& tokenlist,
@@ -5486,7 +5485,7 @@ static void valueFlowInjectParameter(const TokenList& tokenlist,
                                      const Scope* functionScope,
                                      const std::unordered_map<const Variable*, std::list<ValueFlow::Value>>& vars)
 {
-    const bool r = productParams(settings, vars, [&](const std::unordered_map<const Variable*, ValueFlow::Value>& arg) {
+    const std::size_t combinations = productParams(settings, vars, [&](const std::unordered_map<const Variable*, ValueFlow::Value>& arg) {
         auto a = makeMultiValueFlowAnalyzer(arg, settings);
         valueFlowGenericForward(const_cast<Token*>(functionScope->bodyStart),
                                 functionScope->bodyEnd,
@@ -5495,10 +5494,12 @@ static void valueFlowInjectParameter(const TokenList& tokenlist,
                                 errorLogger,
                                 settings);
     });
-    if (!r) {
+    if (combinations > settings.vfOptions.maxSubFunctionArgs) {
         std::string fname = "<unknown>";
         if (const Function* f = functionScope->function)
             fname = f->name();
+        if (!settings.limitsReportFile.empty())
+            errorLogger.reportLimit(tokenlist.getSourceFilePath(), fname, "valueFlowMaxSubFunctionArgs", settings.vfOptions.maxSubFunctionArgs, combinations);
         if (settings.debugwarnings)
             bailout(tokenlist, errorLogger, functionScope->bodyStart, "Too many argument passed to " + fname);
     }
@@ -5646,11 +5647,67 @@ static void valueFlowLibraryFunction(Token* tok, const std::string& returnValue,
     });
 }
 
+using ArgumentValues = std::vector<std::pair<const Variable*, ValueFlow::Value>>;
+
+/** Compare argument values - the error path is not compared */
+struct ArgumentValuesEqual {
+    bool operator()(const ArgumentValues& args1, const ArgumentValues& args2) const {
+        if (args1.size() != args2.size())
+            return false;
+        for (std::size_t i = 0; i < args1.size(); ++i) {
+            if (args1[i].first != args2[i].first || !sameValue(args1[i].second, args2[i].second))
+                return false;
+        }
+        return true;
+    }
+    static bool sameValue(const ValueFlow::Value& v1, const ValueFlow::Value& v2) {
+        return v1 == v2 &&
+               v1.bound == v2.bound &&
+               v1.safe == v2.safe &&
+               v1.macro == v2.macro &&
+               v1.moveKind == v2.moveKind &&
+               v1.lifetimeScope == v2.lifetimeScope &&
+               v1.lifetimeKind == v2.lifetimeKind &&
+               v1.intvalue == v2.intvalue &&
+               v1.tokvalue == v2.tokvalue &&
+               !(v1.floatValue < v2.floatValue || v1.floatValue > v2.floatValue) &&
+               v1.unknownFunctionReturn == v2.unknownFunctionReturn &&
+               v1.path == v2.path &&
+               v1.wideintvalue == v2.wideintvalue &&
+               v1.subexpressions == v2.subexpressions &&
+               v1.capturetok == v2.capturetok;
+    }
+};
+
+/** Hash of argument values which is consistent with ArgumentValuesEqual */
+struct ArgumentValuesHash {
+    std::size_t operator()(const ArgumentValues& args) const {
+        std::size_t h = args.size();
+        for (const auto& arg : args) {
+            const ValueFlow::Value& v = arg.second;
+            h = combine(h, std::hash<const Variable*>{}(arg.first));
+            h = combine(h, static_cast<std::size_t>(v.valueType));
+            h = combine(h, static_cast<std::size_t>(v.valueKind));
+            h = combine(h, v.varId);
+            h = combine(h, static_cast<std::size_t>(v.indirect));
+            h = combine(h, static_cast<std::size_t>(v.intvalue));
+            h = combine(h, std::hash<const Token*>{}(v.tokvalue));
+        }
+        return h;
+    }
+    static std::size_t combine(std::size_t h, std::size_t x) {
+        return h ^ (x + 0x9e3779b9 + (h << 6) + (h >> 2));
+    }
+};
+
 static void valueFlowSubFunction(const TokenList& tokenlist,
                                  const SymbolDatabase& symboldatabase,
                                  ErrorLogger& errorLogger,
                                  const Settings& settings)
 {
+    // the values of a call which only differ in the error path and the path from an earlier
+    // call would be dropped by Token::addValue() so they are injected only once per function
+    std::unordered_map<const Scope*, std::unordered_set<ArgumentValues, ArgumentValuesHash, ArgumentValuesEqual>> injected;
     int id = 0;
     for (auto it = symboldatabase.functionScopes.crbegin(); it != symboldatabase.functionScopes.crend(); ++it) {
         const Scope* scope = *it;
@@ -5722,6 +5779,20 @@ static void valueFlowSubFunction(const TokenList& tokenlist,
 
                 argvars[argvar] = std::move(argvalues);
             }
+            ArgumentValues key;
+            for (const auto& argvar : argvars) {
+                for (const ValueFlow::Value& v : argvar.second) {
+                    key.emplace_back(argvar.first, v);
+                    key.back().second.errorPath.clear();
+                    key.back().second.path = 0;
+                }
+            }
+            std::stable_sort(key.begin(), key.end(), [](const std::pair<const Variable*, ValueFlow::Value>& x,
+                                                 const std::pair<const Variable*, ValueFlow::Value>& y) {
+                return x.first->index() < y.first->index();
+            });
+            if (!injected[calledFunctionScope].insert(std::move(key)).second)
+                continue;
             valueFlowInjectParameter(tokenlist, errorLogger, settings, calledFunctionScope, argvars);
         }
     }
@@ -5809,8 +5880,69 @@ static void setFunctionReturnValue(const Function* f,
     setTokenValue(tok, std::move(v), settings);
 }
 
+/**
+ * Per-function summary of the return values. It is computed once per function and
+ * applied at every call site, instead of re-analyzing the function body for each call.
+ */
+struct FunctionReturnSummary {
+    explicit FunctionReturnSummary(const Function* f)
+        : returns(Function::findReturns(f))
+        , commonValues(getCommonValuesFromTokens(returns))
+    {}
+
+    /**
+     * return values of the function when called with the given argument values. The
+     * error path of the arguments is not part of the key so call sites which pass the
+     * same values share the result - the caller adds its own path to the returned values.
+     */
+    const std::vector<ValueFlow::Value>& execute(const Function* function, ArgumentValues args, const Settings& settings)
+    {
+        for (auto& arg : args)
+            arg.second.errorPath.clear();
+        const auto it = executed.find(args);
+        if (it != executed.cend())
+            return it->second;
+
+        ProgramMemory programMemory;
+        for (const auto& arg : args)
+            programMemory.setValue(arg.first->nameToken(), arg.second);
+        std::vector<ValueFlow::Value> result = ::execute(function->functionScope, programMemory, settings);
+        return executed.emplace(std::move(args), std::move(result)).first->second;
+    }
+
+    std::vector<const Token*> returns;
+    std::vector<ValueFlow::Value> commonValues;
+
+private:
+    std::unordered_map<ArgumentValues, std::vector<ValueFlow::Value>, ArgumentValuesHash, ArgumentValuesEqual> executed;
+};
+
+// Return value of a global function defined in another translation unit
+static void valueFlowSummaryReturn(Token* tok, const Function* function, const Settings& settings)
+{
+    // the summaries are looked up by the unqualified name so only global functions can be matched
+    if (function && (function->hasBody() || !function->nestedIn || function->nestedIn->type != ScopeType::eGlobal))
+        return;
+    if (!Token::Match(tok->previous(), "%name% (") || Token::Match(tok->tokAt(-2), ".|::"))
+        return;
+    // function pointer
+    if (tok->previous()->varId() != 0)
+        return;
+    if (settings.library.functions().count(settings.library.getFunctionName(tok->previous())) != 0)
+        return;
+    const auto it = settings.summaryReturnValue.find(tok->strAt(-1));
+    if (it == settings.summaryReturnValue.end() || it->second.argCount != numberOfArguments(tok))
+        return;
+    ValueFlow::Value v(it->second.value);
+    v.setPossible();
+    v.errorPath.emplace_back(tok, "Calling function '" + tok->strAt(-1) + "' returns " + v.toString());
+    setTokenValue(tok, std::move(v), settings);
+}
+
 static void valueFlowFunctionReturn(TokenList& tokenlist, ErrorLogger& errorLogger, const Settings& settings)
 {
+    std::unordered_map<const Function*, FunctionReturnSummary> summaries;
+
     for (Token* tok = tokenlist.back(); tok; tok = tok->previous()) {
         if (tok->str() != "(" || !tok->astOperand1() || tok->isCast())
             continue;
@@ -5820,6 +5952,8 @@ static void valueFlowFunctionReturn(TokenList& tokenlist, ErrorLogger& errorLogg
             function = tok->previous()->function();
         else
             function = tok->astOperand1()->function();
+        if (!settings.summaryReturnValue.empty() && !tok->hasKnownValue())
+            valueFlowSummaryReturn(tok, function, settings);
         if (!function)
             continue;
         // TODO: Check if member variable is a pointer or reference
@@ -5829,13 +5963,16 @@ static void valueFlowFunctionReturn(TokenList& tokenlist, ErrorLogger& errorLogg
         if (tok->hasKnownValue())
             continue;
 
-        std::vector<const Token*> returns = Function::findReturns(function);
-        if (returns.empty())
+        auto summaryIt = summaries.find(function);
+        if (summaryIt == summaries.end())
+            summaryIt = summaries.emplace(function, FunctionReturnSummary{function}).first;
+        FunctionReturnSummary& summary = summaryIt->second;
+        if (summary.returns.empty())
             continue;
 
         bool hasKnownValue = false;
 
-        for (const ValueFlow::Value& v : getCommonValuesFromTokens(returns)) {
+        for (const ValueFlow::Value& v : summary.commonValues) {
             setFunctionReturnValue(function, tok, v, settings, false);
             if (v.isKnown())
                 hasKnownValue = true;
@@ -5847,27 +5984,32 @@ static void valueFlowFunctionReturn(TokenList& tokenlist, ErrorLogger& errorLogg
         // Arguments..
         std::vector<const Token*> arguments = getArguments(tok);
 
-        ProgramMemory programMemory;
+        std::vector<std::pair<const Variable*, ValueFlow::Value>> args;
+        bool unhandled = false;
         for (std::size_t i = 0; i < arguments.size(); ++i) {
             const Variable* const arg = function->getArgumentVar(i);
             if (!arg) {
                 if (settings.debugwarnings)
                     bailout(tokenlist, errorLogger, tok, "function return; unhandled argument type");
-                programMemory.clear();
+                unhandled = true;
                 break;
             }
             const ValueFlow::Value* v = getKnownValueFromToken(arguments[i]);
             if (!v)
                 continue;
-            programMemory.setValue(arg->nameToken(), *v);
+            args.emplace_back(arg, *v);
         }
-        if (programMemory.empty() && !arguments.empty())
+        if ((unhandled || args.empty()) && !arguments.empty())
             continue;
-        std::vector<ValueFlow::Value> values = execute(function->functionScope, programMemory, settings);
-        for (const ValueFlow::Value& v : values) {
+        ErrorPath errorPath;
+        for (const auto& arg : args)
+            errorPath.insert(errorPath.end(), arg.second.errorPath.cbegin(), arg.second.errorPath.cend());
+        for (const ValueFlow::Value& v : summary.execute(function, std::move(args), settings)) {
             if (v.isUninitValue())
                 continue;
-            setFunctionReturnValue(function, tok, v, settings);
+            ValueFlow::Value value = v;
+            value.errorPath.insert(value.errorPath.begin(), errorPath.cbegin(), errorPath.cend());
+            setFunctionReturnValue(function, tok, std::move(value), settings);
         }
     }
 }
@@ -7244,8 +7386,12 @@ struct ValueFlowPassRunner {
                 return true;
             --n;
         }
-        if (state.settings.debugwarnings) {
-            if (n == 0 && values != getTotalValues()) {
+        if (n == 0 && values != getTotalValues()) {
+            if (!state.settings.limitsReportFile.empty()) {
+                state.errorLogger.reportLimit(state.tokenlist.getSourceFilePath(), "", "valueFlowMaxIterations", state.settings.vfOptions.maxIterations,
+                                              getTotalValues(), elapsedMilliseconds());
+            }
+            if (state.settings.debugwarnings) {
                 ErrorMessage::FileLocation loc(state.tokenlist.getFiles()[0], 0, 0);
                 ErrorMessage errmsg({std::move(loc)},
                                     "",
@@ -7264,17 +7410,17 @@ struct ValueFlowPassRunner {
         auto start = Clock::now();
         if (start > stop) {
             // TODO: add bailout message
+            if (!stopReported && !state.settings.limitsReportFile.empty()) {
+                stopReported = true;
+                state.errorLogger.reportLimit(state.tokenlist.getSourceFilePath(), "", "valueFlowMaxTime", state.settings.vfOptions.maxTime,
+                                              getTotalValues(), elapsedMilliseconds());
+            }
             return true;
         }
         if (!state.tokenlist.isCPP() && pass->cpp())
             return false;
         if (timerResults) {
-            std::string name = pass->name();
-            if (it > 0) {
-                name += ' ';
-                name += std::to_string(it);
-            }
-            Timer t(name, timerResults);
+            Timer t(getTimerName(*pass, it), timerResults);
             pass->run(state);
         } else {
             pass->run(state);
@@ -7284,10 +7430,25 @@ struct ValueFlowPassRunner {
 
     std::size_t getTotalValues() const
     {
-        std::size_t n = 1;
-        for (Token* tok = state.tokenlist.front(); tok; tok = tok->next())
-            n += tok->values().size();
-        return n;
+        return 1 + state.tokenlist.getValueCount();
+    }
+
+    /** the timer of the pass in the given iteration - it is only built once per thread */
+    static const TimerName& getTimerName(const ValueFlowPass& pass, std::size_t it)
+    {
+        // the name of a pass is a string literal so the pointer identifies it
+        thread_local std::map<std::pair<const char*, std::size_t>, TimerName> timerNames;
+        const std::pair<const char*, std::size_t> key(pass.name(), it);
+        auto i = timerNames.find(key);
+        if (i == timerNames.end()) {
+            std::string name = pass.name();
+            if (it > 0) {
+                name += ' ';
+                name += std::to_string(it);
+            }
+            i = timerNames.emplace(key, TimerName(std::move(name))).first;
+        }
+        return i->second;
     }
 
     void setSkippedFunctions()
@@ -7308,6 +7469,11 @@ struct ValueFlowPassRunner {
                 if (countIfScopes > state.settings.vfOptions.maxIfCount) {
                     state.skippedFunctions.emplace(functionScope);
 
+                    if (!state.settings.limitsReportFile.empty()) {
+                        state.errorLogger.reportLimit(state.tokenlist.getSourceFilePath(), functionScope->className, "valueFlowMaxIfCount",
+                                                      state.settings.vfOptions.maxIfCount, countIfScopes);
+                    }
+
                     if (state.settings.severity.isEnabled(Severity::information)) {
                         const std::string& functionName = functionScope->className;
                         std::list<ErrorMessage::FileLocation> callstack(
@@ -7329,12 +7495,20 @@ struct ValueFlowPassRunner {
 
     void setStopTime()
     {
+        startTime = Clock::now();
         if (state.settings.vfOptions.maxTime >= 0)
-            stop = Clock::now() + std::chrono::seconds{state.settings.vfOptions.maxTime};
+            stop = startTime + std::chrono::seconds{state.settings.vfOptions.maxTime};
+    }
+
+    std::int64_t elapsedMilliseconds() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - startTime).count();
     }
 
     ValueFlowState state;
+    TimePoint startTime;
     TimePoint stop;
+    mutable bool stopReported{};
     TimerResultsIntf* timerResults;
 };
 
@@ -7389,7 +7563,8 @@ void ValueFlow::setValues(TokenList& tokenlist,
 {
     ProgressReporter progressReporter(errorLogger, settings.reportProgress, tokenlist.getSourceFilePath(), "ValueFlow");
 
-    for (Token* tok = tokenlist.front(); tok; tok = tok->next())
+    // values are counted by the token list so there is no need to visit all tokens if there are none
+    for (Token* tok = tokenlist.front(); tok && tokenlist.getValueCount() > 0; tok = tok->next())
         tok->clearValueFlow();
 
     // commas in init..
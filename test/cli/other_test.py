@@ -2,6 +2,7 @@
 # python -m pytest test-other.py
 
 import os
+import re
 import sys
 import pytest
 import glob
@@ -1045,7 +1046,7 @@ def test_showtime_top5_summary_compdb(tmp_path):
 
 
 def __test_showtime_file(tmp_path, use_compdb=False, use_addons=False, use_clang_tidy=False):
-    exp_res = 79
+    exp_res = 81
     # project analysis does not call Preprocessor::getConfig()
     if use_compdb:
         exp_res -= 1
@@ -1079,7 +1080,7 @@ def test_showtime_file_clang_tidy_compdb(tmp_path):
 
 
 def __test_showtime_summary(tmp_path, use_compdb=False, use_addons=False, use_clang_tidy=False):
-    exp_res = 79
+    exp_res = 81
     # project analysis does not call Preprocessor::getConfig()
     if use_compdb:
         exp_res -= 1
@@ -1124,6 +1125,591 @@ def test_showtime_file_total_compdb(tmp_path):
     __test_showtime_file_total(tmp_path, True)
 
 
+def __test_trace(tmp_path, extra_args):
+    test_file = tmp_path / 'test.cpp'
+    with open(test_file, 'wt') as f:
+        f.write(
+"""
+#ifdef X
+int x;
+#endif
+void f() {}
+""")
+
+    trace_file = tmp_path / 'trace.json'
+
+    args = [
+        '--trace={}'.format(trace_file),
+        '--quiet',
+        str(test_file)
+    ] + extra_args
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stdout == ''  # the timing information is not shown without --showtime
+    assert stderr == ''
+
+    with open(trace_file, 'rt') as f:
+        trace = json.load(f)
+    events = trace['traceEvents']
+    for e in events:
+        assert e['ph'] == 'X'
+        assert e['ts'] >= 0
+        assert e['dur'] >= 0
+        assert e['args']['file'] == str(test_file)
+
+    file_spans = [e for e in events if e['name'] == 'CppCheck::checkFile']
+    assert len(file_spans) == 1
+    file_span = file_spans[0]
+
+    simplify_spans = [e for e in events if e['name'] == 'Tokenizer::simplifyTokens1::simplifyTokenList1']
+    assert sorted(e['args']['cfg'] for e in simplify_spans) == ['', 'X=X']
+    for e in simplify_spans:
+        # nested within the span of the whole file
+        assert e['pid'] == file_span['pid']
+        assert e['tid'] == file_span['tid']
+        # the timestamps are in microseconds with nanosecond precision
+        assert e['ts'] >= file_span['ts'] - 0.001
+        assert e['ts'] + e['dur'] <= file_span['ts'] + file_span['dur'] + 0.001
+
+
+def test_trace(tmp_path):
+    __test_trace(tmp_path, ['-j1'])
+
+
+def test_trace_j2_thread(tmp_path):
+    __test_trace(tmp_path, ['-j2', '--executor=thread'])
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="requires ProcessExecutor")
+def test_trace_j2_process(tmp_path):
+    __test_trace(tmp_path, ['-j2', '--executor=process'])
+
+
+def __test_showmemory(tmp_path, extra_args):
+    test_file = tmp_path / 'test.cpp'
+    with open(test_file, 'wt') as f:
+        f.write(
+"""
+struct S {
+    int i;
+};
+void f(S s)
+{
+    (void)s.i;
+}
+""")
+
+    args = [
+        '--showmemory',
+        '--quiet',
+        str(test_file)
+    ] + extra_args
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+    lines = stdout.splitlines()
+    # the measurements of the file and the overall peak RSS
+    assert len([line for line in lines if line.startswith('Peak RSS: ')]) == 2, stdout
+    assert lines[-1].startswith('Peak RSS: ')
+    assert [line for line in lines if line.startswith('Token: ')]
+    assert [line for line in lines if line.startswith('Scope: 3 object(s) (')]
+    assert [line for line in lines if line.startswith('Function: 1 object(s) (')]
+    assert [line for line in lines if line.startswith('Tokenizer::simplifyTokens1::ValueFlow: ') and line.endswith(' KiB RSS (1 result(s))')]
+
+
+def test_showmemory(tmp_path):
+    __test_showmemory(tmp_path, ['-j1'])
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="requires ProcessExecutor")
+def test_showmemory_j2_process(tmp_path):
+    __test_showmemory(tmp_path, ['-j2', '--executor=process'])
+
+
+def __test_showcounters(tmp_path, extra_args):
+    test_file = tmp_path / 'test.cpp'
+    with open(test_file, 'wt') as f:
+        f.write(
+"""
+int f(int i)
+{
+    return i + 1;
+}
+""")
+
+    args = [
+        '--showtime=summary',
+        '--showcounters',
+        '--quiet',
+        str(test_file)
+    ] + extra_args
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+    lines = stdout.splitlines()
+    valueflow = [line for line in lines if line.startswith('Tokenizer::simplifyTokens1::ValueFlow: ')]
+    assert len(valueflow) == 1, stdout
+    if lines[0].startswith("cppcheck: '--showcounters' has no effect - "):
+        # the hardware counters are not available on this system
+        assert ' [' not in valueflow[0]
+    else:
+        assert valueflow[0].endswith(']'), stdout
+        assert ' [cycles: ' in valueflow[0] or ' [instructions: ' in valueflow[0], stdout
+
+
+def test_showcounters(tmp_path):
+    __test_showcounters(tmp_path, ['-j1'])
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="requires ProcessExecutor")
+def test_showcounters_j2_process(tmp_path):
+    __test_showcounters(tmp_path, ['-j2', '--executor=process'])
+
+
+def test_showcounters_no_showtime(tmp_path):
+    test_file = tmp_path / 'test.cpp'
+    with open(test_file, 'wt'):
+        pass
+
+    args = [
+        '--showcounters',
+        '--quiet',
+        str(test_file)
+    ]
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stdout.splitlines() == [
+        "cppcheck: '--showcounters' has no effect without '--showtime'."
+    ]
+    assert stderr == ''
+
+
+def __test_report_slowest(tmp_path, extra_args):
+    test_file_1 = tmp_path / 'test1.cpp'
+    with open(test_file_1, 'wt') as f:
+        f.write('int f1(int i) { return i + 1; }\n')
+    test_file_2 = tmp_path / 'test2.cpp'
+    with open(test_file_2, 'wt') as f:
+        f.write('int f2(int i) { return i + 2; }\n')
+
+    build_dir = tmp_path / 'b1'
+    os.mkdir(build_dir)
+
+    args = [
+        '--cppcheck-build-dir={}'.format(build_dir),
+        '--report-slowest=1',
+        '--quiet',
+        str(test_file_1),
+        str(test_file_2)
+    ] + extra_args
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+    lines = stdout.splitlines()
+    assert lines[0] == 'Slowest files:', stdout
+    assert re.match(r'^.*test[12]\.cpp: \d+\.\d{3}s, \d+ tokens$', lines[1]), stdout
+    # the slowest phases
+    assert len(lines) == 5, stdout
+
+    # the timings are only recorded again if the file changed
+    with open(test_file_1, 'at') as f:
+        f.write('int g1(int i) { return i + 3; }\n')
+    with open(test_file_2, 'at') as f:
+        f.write('int g2(int i) { return i + 4; }\n')
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+    lines = stdout.splitlines()
+    assert lines[0] == 'Slowest files:', stdout
+    assert re.match(r'^.*test[12]\.cpp: \d+\.\d{3}s, \d+ tokens - previous run: \d+\.\d{3}s \([+-]\d+%\), \d+ tokens$', lines[1]), stdout
+    assert re.match(r'^    history: \d+\.\d{3}s \d+\.\d{3}s$', lines[2]), stdout
+
+    with open(build_dir / 'test1.a1', 'rt') as f:
+        analyzerinfo = f.read()
+    assert analyzerinfo.count('<timings run=') == 2, analyzerinfo
+    assert '<phase name="Tokenizer::simplifyTokens1::ValueFlow" time="' in analyzerinfo
+
+
+def test_report_slowest(tmp_path):
+    __test_report_slowest(tmp_path, ['-j1'])
+
+
+def test_report_slowest_j2_thread(tmp_path):
+    __test_report_slowest(tmp_path, ['-j2', '--executor=thread'])
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="requires ProcessExecutor")
+def test_report_slowest_j2_process(tmp_path):
+    __test_report_slowest(tmp_path, ['-j2', '--executor=process'])
+
+
+def test_report_slowest_skipped_config(tmp_path):
+    test_file = tmp_path / 'test.cpp'
+    with open(test_file, 'wt') as f:
+        f.write("""
+#ifdef A
+#endif
+#ifdef B
+int f1(int i) { return i + 1; }
+#else
+int f2(int i) { return i + 2; }
+#endif
+""")
+
+    build_dir = tmp_path / 'b1'
+    os.mkdir(build_dir)
+
+    args = [
+        '--cppcheck-build-dir={}'.format(build_dir),
+        '--report-slowest=1',
+        '--quiet',
+        str(test_file)
+    ]
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+    # the configuration 'A=A' has the same code as '' and is skipped
+    lines = stdout.splitlines()
+    assert lines[0] == 'Slowest files:', stdout
+    configs = [line for line in lines if line.startswith('    configuration ')]
+    assert len(configs) == 2, stdout
+    assert re.match(r"^    configuration '': \d+\.\d{3}s, [1-9]\d* tokens$", configs[0]), stdout
+    assert re.match(r"^    configuration 'B=B': \d+\.\d{3}s, [1-9]\d* tokens$", configs[1]), stdout
+
+
+def __test_progress_stream(tmp_path, extra_args, executor):
+    test_file_1 = tmp_path / 'test1.cpp'
+    with open(test_file_1, 'wt') as f:
+        f.write('int f1(int i) { return i + 1; }\n')
+    test_file_2 = tmp_path / 'test2.cpp'
+    with open(test_file_2, 'wt') as f:
+        f.write('int f2(int i) { return i + 2; }\n')
+
+    args = [
+        '--progress-stream=fd:1',
+        '--quiet',
+        str(test_file_1),
+        str(test_file_2)
+    ] + extra_args
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+    events = [json.loads(line) for line in stdout.splitlines()]
+
+    assert events[0]['event'] == 'start'
+    assert events[0]['executor'] == executor
+    assert events[0]['files_total'] == 2
+    assert events[0]['size_total'] == 64
+
+    # a progress event is written for each analyzed file and at most once per second otherwise
+    workers = events[0]['workers']
+    progress_events = events[1:-1]
+    assert len(progress_events) >= 2, stdout
+    files_done = 0
+    for progress in progress_events:
+        assert progress['event'] == 'progress'
+        assert progress['files_done'] >= files_done
+        files_done = progress['files_done']
+        assert progress['files_total'] == 2
+        assert progress['size_done'] == 32 * files_done
+        assert progress['queue'] <= 2 - files_done
+        assert len(progress['workers']) == workers
+    last = progress_events[-1]
+    assert last['files_done'] == 2
+    assert last['tokens_done'] > 0
+    assert last['tokens_per_second'] > 0
+    assert last['files_per_second'] > 0
+    assert last['eta'] == 0
+    assert last['workers'] == [{'id': i, 'file': None, 'phase': None} for i in range(workers)]
+
+    assert events[-1]['event'] == 'finish'
+    assert events[-1]['files_done'] == 2
+    assert events[-1]['size_done'] == 64
+    assert events[-1]['tokens_done'] == last['tokens_done']
+
+
+def test_progress_stream(tmp_path):
+    __test_progress_stream(tmp_path, ['-j1'], 'single')
+
+
+def test_progress_stream_j2_thread(tmp_path):
+    __test_progress_stream(tmp_path, ['-j2', '--executor=thread'], 'thread')
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="requires ProcessExecutor")
+def test_progress_stream_j2_process(tmp_path):
+    __test_progress_stream(tmp_path, ['-j2', '--executor=process'], 'process')
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="requires UNIX sockets")
+def test_progress_stream_unix(tmp_path):
+    import socket
+    import threading
+
+    test_file = tmp_path / 'test.cpp'
+    with open(test_file, 'wt') as f:
+        f.write('int f(int i) { return i + 1; }\n')
+
+    socket_path = str(tmp_path / 'progress.sock')
+    server = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    server.bind(socket_path)
+    server.listen(1)
+
+    received = []
+
+    def receive():
+        conn, _ = server.accept()
+        with conn:
+            while True:
+                data = conn.recv(4096)
+                if not data:
+                    break
+                received.append(data)
+
+    receiver = threading.Thread(target=receive)
+    receiver.start()
+    try:
+        exitcode, stdout, stderr = cppcheck(['--progress-stream=unix:{}'.format(socket_path), '--quiet', str(test_file)])
+    finally:
+        receiver.join(timeout=60)
+        server.close()
+    assert exitcode == 0, stdout
+    assert stdout == ''
+    assert stderr == ''
+
+    events = [json.loads(line) for line in b''.join(received).decode().splitlines()]
+    assert events[0]['event'] == 'start'
+    assert all(e['event'] == 'progress' for e in events[1:-1])
+    assert events[-2]['files_done'] == 1
+    assert events[-1]['event'] == 'finish'
+    assert events[-1]['files_done'] == 1
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="file descriptor is only checked on POSIX")
+def test_progress_stream_not_open(tmp_path):
+    test_file = tmp_path / 'test.cpp'
+    with open(test_file, 'wt'):
+        pass
+
+    exitcode, stdout, stderr = cppcheck(['--progress-stream=fd:99', '--quiet', str(test_file)])
+    assert exitcode == 1, stdout
+    assert stdout.splitlines() == [
+        'cppcheck: error: could not open the progress stream - file descriptor 99 is not open - Bad file descriptor.'
+    ]
+    assert stderr == ''
+
+
+def __test_progress_stream_reader_closed(tmp_path, extra_args):
+    test_file_1 = tmp_path / 'test1.cpp'
+    with open(test_file_1, 'wt') as f:
+        f.write('void f1() { int* p = nullptr; *p = 0; }\n')
+    test_file_2 = tmp_path / 'test2.cpp'
+    with open(test_file_2, 'wt') as f:
+        f.write('void f2() { int* p = nullptr; *p = 0; }\n')
+
+    # the reader goes away before anything has been written
+    rpipe, wpipe = os.pipe()
+    os.close(rpipe)
+    try:
+        args = [__lookup_cppcheck_exe(), '--progress-stream=fd:{}'.format(wpipe), '--quiet', '--template=simple', str(test_file_1), str(test_file_2)] + extra_args
+        p = subprocess.run(args, stdout=subprocess.PIPE, stderr=subprocess.PIPE, pass_fds=(wpipe,), timeout=60)
+    finally:
+        os.close(wpipe)
+    stderr = p.stderr.decode().splitlines()
+
+    # the analysis is not aborted
+    assert p.returncode == 0, p.stdout.decode()
+    assert stderr[0] == 'cppcheck: the reader of the progress stream has gone away - no further progress is written'
+    assert sorted(stderr[1:]) == [
+        '{}:1:32: error: Null pointer dereference: p [nullPointer]'.format(test_file_1),
+        '{}:1:32: error: Null pointer dereference: p [nullPointer]'.format(test_file_2)
+    ]
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="requires SIGPIPE")
+def test_progress_stream_reader_closed(tmp_path):
+    __test_progress_stream_reader_closed(tmp_path, ['-j1'])
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="requires SIGPIPE")
+def test_progress_stream_reader_closed_j2_process(tmp_path):
+    __test_progress_stream_reader_closed(tmp_path, ['-j2', '--executor=process'])
+
+
+def __run_match_profile(tmp_path, extra_args):
+    test_file_1 = tmp_path / 'test1.cpp'
+    with open(test_file_1, 'wt') as f:
+        f.write('int f1(int* p) { return p ? *p : 0; }\n')
+    test_file_2 = tmp_path / 'test2.cpp'
+    with open(test_file_2, 'wt') as f:
+        f.write('int f2(int* p) { return p ? *p : 1; }\n')
+
+    profile_file = tmp_path / 'profile.txt'
+    if os.path.exists(profile_file):
+        os.remove(profile_file)
+    env = os.environ.copy()
+    env['CPPCHECK_MATCH_PROFILE'] = str(profile_file)
+
+    exitcode, stdout, stderr = cppcheck(['-q', str(test_file_1), str(test_file_2)] + extra_args, env=env)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+    if not os.path.exists(profile_file):
+        return None
+    with open(profile_file, 'rt') as f:
+        lines = f.read().splitlines()
+    assert lines[0] == 'time[ms] calls matches location pattern'
+    return lines[1:]
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="requires ProcessExecutor")
+def test_match_profile_j2_process(tmp_path):
+    profile_j1 = __run_match_profile(tmp_path, ['-j1'])
+    if profile_j1 is None:
+        pytest.skip('requires a build with ENABLE_MATCH_PROFILING')
+    profile_j2 = __run_match_profile(tmp_path, ['-j2', '--executor=process'])
+    assert profile_j2 is not None
+
+    def total_calls(profile):
+        return sum(int(line.split(' ')[1]) for line in profile)
+
+    # the results of the child processes are part of the report of the main process
+    assert not any(line.startswith('time[ms]') for line in profile_j2)
+    assert total_calls(profile_j2) >= total_calls(profile_j1) * 0.9, (profile_j1, profile_j2)
+
+
+def __test_limits_report(tmp_path, extra_args):
+    test_file = tmp_path / 'test.c'
+    with open(test_file, 'wt') as f:
+        f.write("""
+void f(bool b)
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        if (i == 0) {}
+        if (b) continue;
+    }
+}
+void g(int x)
+{
+""" + "    if (x == 1) {}\n" * 101 + """
+}
+void h(bool b, int x, int y)
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        if (x == 0) {}
+        if (y == 0) {}
+        if (b) continue;
+    }
+}
+""")
+
+    limits_file = tmp_path / 'limits.xml'
+
+    args = [
+        '--enable=warning',  # to execute the code which hits the maxForwardBranches limit
+        '--limits-report={}'.format(limits_file),
+        '--quiet',
+        str(test_file)
+    ] + extra_args
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+
+    root = ElementTree.fromstring(limits_file.read_text())
+    assert root.tag == 'limits'
+    limits = {(l.get('id'), l.get('function')): l for l in root}
+    # a limit is only reported once per function even if it is hit by several analyses
+    assert len(limits) == len(root), limits_file.read_text()
+    assert ('valueFlowMaxIfCount', 'g') in limits, limits_file.read_text()
+    limit = limits[('valueFlowMaxIfCount', 'g')]
+    assert limit.get('fileName') == str(test_file)
+    assert limit.get('limit') == '100'
+    assert limit.get('work') == '101'
+    assert limit.get('time') is None
+    assert ('valueFlowMaxForwardBranches', 'f') in limits, limits_file.read_text()
+    limit = limits[('valueFlowMaxForwardBranches', 'f')]
+    assert limit.get('limit') == '4'
+    assert limit.get('work') == '5'
+    assert int(limit.get('time')) >= 0
+
+
+def test_limits_report(tmp_path):
+    __test_limits_report(tmp_path, ['-j1'])
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="requires ProcessExecutor")
+def test_limits_report_j2_process(tmp_path):
+    __test_limits_report(tmp_path, ['-j2', '--executor=process'])
+
+
+def test_limits_report_sub_function_args(tmp_path):
+    test_file = tmp_path / 'test.c'
+    with open(test_file, 'wt') as f:
+        f.write("""
+int k(int a, int b, int c, int d)
+{
+    return a + b + c + d;
+}
+void f(int w, int x, int y, int z)
+{
+    k(w ? 1 : 2, x ? 1 : 2, y ? 1 : 2, z ? 1 : 2);
+}
+""")
+
+    limits_file = tmp_path / 'limits.xml'
+
+    args = [
+        '--check-level=reduced',  # to limit the argument combinations to 8
+        '--limits-report={}'.format(limits_file),
+        '--quiet',
+        str(test_file)
+    ]
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+
+    root = ElementTree.fromstring(limits_file.read_text())
+    limits = {(l.get('id'), l.get('function')): l for l in root}
+    assert ('valueFlowMaxSubFunctionArgs', 'k') in limits, limits_file.read_text()
+    limit = limits[('valueFlowMaxSubFunctionArgs', 'k')]
+    assert limit.get('limit') == '8'
+    # the amount of argument combinations
+    assert limit.get('work') == '16'
+
+
+def test_limits_report_none(tmp_path):
+    test_file = tmp_path / 'test.c'
+    with open(test_file, 'wt') as f:
+        f.write("void f() {}\n")
+
+    limits_file = tmp_path / 'limits.xml'
+
+    args = [
+        '--limits-report={}'.format(limits_file),
+        '--quiet',
+        str(test_file)
+    ]
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+
+    root = ElementTree.fromstring(limits_file.read_text())
+    assert root.tag == 'limits'
+    assert len(root) == 0
+
+
 def test_showtime_unique(tmp_path):
     test_file = tmp_path / 'test.cpp'
     with open(test_file, 'wt') as f:
@@ -1156,6 +1742,40 @@ void f()
     assert stderr == ''
 
 
+def test_showtime_unusedfunction_only(tmp_path):
+    test_file = tmp_path / 'test.cpp'
+    with open(test_file, 'wt') as f:
+        f.write(
+"""
+static void f() {}
+""")
+
+    args = [
+        '--showtime=summary',
+        '--quiet',
+        '--enable=unusedFunction',
+        '-j1',
+        str(test_file)
+    ]
+
+    # no ValueFlow is needed when only unusedFunction is checked
+    exitcode, stdout, stderr, _ = cppcheck_ex(args, env={'UNUSEDFUNCTION_ONLY': '1'})
+    assert exitcode == 0, stdout
+    assert 'Tokenizer::simplifyTokens1::createSymbolDatabase' in stdout
+    assert 'Tokenizer::simplifyTokens1::ValueFlow' not in stdout
+
+    # the values are still needed for the dump file and the debug output
+    for extra_args in [['--dump'], ['--debug-valueflow']]:
+        exitcode, stdout, stderr, _ = cppcheck_ex(args + extra_args, env={'UNUSEDFUNCTION_ONLY': '1'})
+        assert exitcode == 0, stdout
+        assert 'Tokenizer::simplifyTokens1::ValueFlow' in stdout, extra_args
+
+    # the checks with the "error" severity are always performed so the values are needed
+    exitcode, stdout, stderr, _ = cppcheck_ex(args)
+    assert exitcode == 0, stdout
+    assert 'Tokenizer::simplifyTokens1::ValueFlow' in stdout
+
+
 def test_missing_addon(tmpdir):
     args = ['--addon=misra3', '--addon=misra', '--addon=misra2', 'file.c']
 
@@ -2333,6 +2953,102 @@ void f(bool b)
     assert hash_1 != hash_2
 
 
+def test_builddir_summary_return_namespace(tmp_path):
+    test_file_a = tmp_path / 'a.cpp'
+    with open(test_file_a, 'wt') as f:
+        f.write("""
+namespace ns { int* find() { return nullptr; } }
+namespace { int* lookup() { return nullptr; } }
+int* get() { return nullptr; }
+""")
+
+    test_file_b = tmp_path / 'b.cpp'
+    with open(test_file_b, 'wt') as f:
+        f.write("""
+int* find();
+int* lookup();
+int* get();
+void f() {
+    *find() = 0;
+    *lookup() = 0;
+    *get() = 0;
+}
+""")
+
+    build_dir = tmp_path / 'b1'
+    os.mkdir(build_dir)
+
+    args = [
+        '--cppcheck-build-dir={}'.format(build_dir),
+        '--template=simple',
+        str(test_file_a)
+    ]
+
+    # the summaries are written by the first run and used by the second one
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+
+    exitcode, stdout, stderr = cppcheck(args + [str(test_file_b)])
+    assert exitcode == 0, stdout
+    assert stderr.splitlines() == [
+        "{}:8:9: warning: Possible null pointer dereference: get() [nullPointer]".format(test_file_b)
+    ]
+
+
+def test_builddir_summary_return_changed(tmp_path):
+    test_file_c = tmp_path / 'c.cpp'
+    with open(test_file_c, 'wt') as f:
+        f.write("""
+int* get() { return nullptr; }
+""")
+
+    test_file_d = tmp_path / 'd.cpp'
+    with open(test_file_d, 'wt') as f:
+        f.write("""
+int* get();
+void f() {
+    *get() = 1;
+}
+""")
+
+    build_dir = tmp_path / 'b1'
+    os.mkdir(build_dir)
+
+    args = [
+        '--cppcheck-build-dir={}'.format(build_dir),
+        '--template=simple',
+        str(test_file_c),
+        str(test_file_d)
+    ]
+
+    # the summaries are written by the first run and used by the second one
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr.splitlines() == [
+        "{}:4:9: warning: Possible null pointer dereference: get() [nullPointer]".format(test_file_d)
+    ]
+
+    with open(test_file_c, 'wt') as f:
+        f.write("""
+int x;
+int* get() { return &x; }
+""")
+
+    # the changed summary is written by this run
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+
+    # the result of d.cpp must not be taken from the build dir since the summary it used has changed
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    assert stderr == ''
+
+
 def test_def_undef(tmp_path):
     test_file = tmp_path / 'test.c'
     with open(test_file, 'wt') as f:
@@ -4749,4 +5465,29 @@ def test_ipc_inline_suppressions(tmp_path):
     stdout_lines = stdout.splitlines()
     stdout_lines.sort()
     assert stdout_lines == stdout_exp
-    assert stderr.splitlines() == []
\ No newline at end of file
+    assert stderr.splitlines() == []
+
+def test_purged_configuration_not_simplified(tmp_path):
+    test_file = tmp_path / 'test.cpp'
+    with open(test_file, 'wt') as f:
+        f.write(
+"""
+#ifdef X
+#endif
+void f() {}
+""")
+
+    args = [
+        '--showtime=summary',
+        '--debug-warnings',
+        '-q',
+        str(test_file)
+    ]
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    # the configuration with the same preprocessed code is skipped before it is simplified
+    assert f"{test_file}:0:0: information: The configuration 'X=X' was not checked because its code equals another one. [purgedConfiguration]" in stderr.splitlines()
+    lines = [line for line in stdout.splitlines() if line.startswith('Tokenizer::simplifyTokens1:')]
+    assert lines
+    assert lines[0].endswith(' - 1 result(s))')
@@ -413,3 +413,17 @@ def test_slow_bifurcate(tmpdir):
                 	}
                 }""")
     cppcheck([filename]) # should not take more than ~1 second
+
+
+@pytest.mark.timeout(30)
+def test_slow_many_out_of_line_members(tmpdir):
+    # setVarId compared every out-of-line member with every class
+    filename = os.path.join(tmpdir, 'hang.cpp')
+    with open(filename, 'wt') as f:
+        f.write("namespace ns {\n")
+        for i in range(2000):
+            f.write(f"struct C{i} {{\n    int m{i};\n    void f{i}();\n}};\n")
+        f.write("}\n")
+        for i in range(2000):
+            f.write(f"void ns::C{i}::f{i}() {{ m{i} = 0; }}\n")
+    cppcheck([filename])
@@ -23,8 +23,14 @@
 #include "fixture.h"
 #include "standards.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <list>
+#include <map>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "xml.h"
 
@@ -45,6 +51,8 @@ private:
         TEST_CASE(filesTextDuplicateFile);
         TEST_CASE(parse);
         TEST_CASE(skipAnalysis);
+        TEST_CASE(timingsXml);
+        TEST_CASE(reportSlowest);
     }
 
     void getAnalyzerInfoFileFromFilesTxt() const {
@@ -268,6 +276,77 @@ private:
             ASSERT_EQUALS(0, errorList.size());
         }
     }
+
+    static AnalyzerInformation::Timings createTimings(std::int64_t run, double time, std::size_t tokens, double valueFlow) {
+        AnalyzerInformation::Timings timings;
+        timings.run = run;
+        timings.time = time;
+        AnalyzerInformation::Timings::Config config;
+        config.time = time;
+        config.tokens = tokens;
+        config.phases["Tokenizer::simplifyTokens1::ValueFlow"] = valueFlow;
+        config.phases["Tokenizer::createTokens"] = 0.25;
+        timings.configs.push_back(std::move(config));
+        return timings;
+    }
+
+    void timingsXml() const {
+        AnalyzerInformation::Timings timings = createTimings(1700000000, 1.5, 100, 0.5);
+        AnalyzerInformation::Timings::Config config;
+        config.name = "A<1";
+        config.time = 0.5;
+        config.tokens = 20;
+        config.phases["Tokenizer::createTokens"] = 0.125;
+        timings.configs.push_back(std::move(config));
+
+        const std::string xml = timings.toXML();
+        ASSERT_EQUALS("  <timings run=\"1700000000\" time=\"1.5\">\n"
+                      "    <config name=\"\" time=\"1.5\" tokens=\"100\">\n"
+                      "      <phase name=\"Tokenizer::createTokens\" time=\"0.25\"/>\n"
+                      "      <phase name=\"Tokenizer::simplifyTokens1::ValueFlow\" time=\"0.5\"/>\n"
+                      "    </config>\n"
+                      "    <config name=\"A&lt;1\" time=\"0.5\" tokens=\"20\">\n"
+                      "      <phase name=\"Tokenizer::createTokens\" time=\"0.125\"/>\n"
+                      "    </config>\n"
+                      "  </timings>\n", xml);
+
+        tinyxml2::XMLDocument doc;
+        ASSERT_EQUALS(tinyxml2::XML_SUCCESS, doc.Parse(xml.c_str()));
+        const AnalyzerInformation::Timings parsed = AnalyzerInformation::Timings::fromXML(doc.FirstChildElement());
+        ASSERT_EQUALS(1700000000, parsed.run);
+        ASSERT_EQUALS_DOUBLE(1.5, parsed.time, 0.0001);
+        ASSERT_EQUALS(2, parsed.configs.size());
+        ASSERT_EQUALS("A<1", parsed.configs[1].name);
+        ASSERT_EQUALS(120, parsed.tokens());
+        const std::map<std::string, double> phases = parsed.phases();
+        ASSERT_EQUALS(2, phases.size());
+        ASSERT_EQUALS_DOUBLE(0.375, phases.at("Tokenizer::createTokens"), 0.0001);
+        ASSERT_EQUALS(xml, parsed.toXML());
+    }
+
+    void reportSlowest() const {
+        ASSERT_EQUALS("No analysis timings have been recorded.\n", AnalyzerInformation::reportSlowest({}, 5));
+
+        std::vector<AnalyzerInformation::FileTimings> timings(3);
+        timings[0].info.sourceFile = "fast.c";
+        timings[0].runs.push_back(createTimings(1, 0.5, 50, 0.125));
+        timings[1].info.sourceFile = "slow.c";
+        timings[1].info.cfg = "Debug";
+        timings[1].runs.push_back(createTimings(1, 1.0, 100, 0.5));
+        timings[1].runs.push_back(createTimings(2, 2.0, 110, 1.5));
+        timings[2].info.sourceFile = "new.c";
+        timings[2].runs.push_back(createTimings(2, 1.0, 80, 0.125));
+
+        ASSERT_EQUALS("Slowest files:\n"
+                      "slow.c (Debug): 2.000s, 110 tokens - previous run: 1.000s (+100%), 100 tokens\n"
+                      "    history: 1.000s 2.000s\n"
+                      "    Tokenizer::simplifyTokens1::ValueFlow: 1.500s (+200%)\n"
+                      "    Tokenizer::createTokens: 0.250s (+0%)\n"
+                      "new.c: 1.000s, 80 tokens\n"
+                      "    Tokenizer::createTokens: 0.250s\n"
+                      "    Tokenizer::simplifyTokens1::ValueFlow: 0.125s\n",
+                      AnalyzerInformation::reportSlowest(timings, 2));
+    }
 };
 
 REGISTER_TEST(TestAnalyzerInformation)
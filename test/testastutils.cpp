@@ -26,6 +26,8 @@
 
 #include <cstdint>
 #include <cstring>
+#include <string>
+#include <vector>
 
 class TestAstUtils : public TestFixture {
 public:
@@ -47,6 +49,7 @@ private:
         TEST_CASE(isExpressionChangedTest);
         TEST_CASE(nextAfterAstRightmostLeafTest);
         TEST_CASE(isUsedAsBool);
+        TEST_CASE(astFlattenTest);
     }
 
 #define findLambdaEndToken(...) findLambdaEndToken_(__FILE__, __LINE__, __VA_ARGS__)
@@ -518,6 +521,22 @@ private:
         ASSERT(Result::True == isUsedAsBool("int g(); void h(bool); void f() { h(g()); }", "( ) )"));
         ASSERT(Result::True == isUsedAsBool("int g(int); void h(bool); void f() { h(g(0)); }", "( 0 ) )"));
     }
+
+    void astFlattenTest() {
+        std::string code = "void f() { g(0";
+        for (int i = 1; i < 1000; ++i)
+            code += ", " + std::to_string(i);
+        code += "); }";
+        SimpleTokenizer tokenizer(settingsDefault, *this);
+        ASSERT(tokenizer.tokenize(code));
+        const Token * const tok = Token::findsimplematch(tokenizer.tokens(), "g (");
+        ASSERT(tok);
+        const std::vector<const Token*> args = ::astFlatten(tok->next()->astOperand2(), ",");
+        ASSERT_EQUALS(1000, args.size());
+        ASSERT_EQUALS("0", args.front()->str());
+        ASSERT_EQUALS("500", args[500]->str());
+        ASSERT_EQUALS("999", args.back()->str());
+    }
 };
 
 REGISTER_TEST(TestAstUtils)
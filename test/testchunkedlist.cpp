@@ -0,0 +1,124 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "chunkedlist.h"
+#include "fixture.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class TestChunkedList : public TestFixture {
+public:
+    TestChunkedList() : TestFixture("TestChunkedList") {}
+
+private:
+    void run() override {
+        TEST_CASE(empty);
+        TEST_CASE(growth);
+        TEST_CASE(elements);
+        TEST_CASE(iterators);
+        TEST_CASE(popBack);
+    }
+
+    void empty() const {
+        const ChunkedList<int> list;
+        ASSERT_EQUALS(true, list.empty());
+        ASSERT_EQUALS(0, list.size());
+        ASSERT_EQUALS(0, list.capacity());
+        ASSERT(list.cbegin() == list.cend());
+    }
+
+    void growth() const {
+        // each chunk is twice as large as the previous one
+        ChunkedList<int, 1> list1;
+        list1.push_back(0);
+        ASSERT_EQUALS(1, list1.capacity());
+        list1.push_back(1);
+        ASSERT_EQUALS(3, list1.capacity());
+        list1.push_back(2);
+        ASSERT_EQUALS(3, list1.capacity());
+        list1.push_back(3);
+        ASSERT_EQUALS(7, list1.capacity());
+
+        ChunkedList<int, 4> list4;
+        for (int i = 0; i < 5; ++i)
+            list4.push_back(i);
+        ASSERT_EQUALS(12, list4.capacity());
+        for (int i = 5; i < 13; ++i)
+            list4.push_back(i);
+        ASSERT_EQUALS(28, list4.capacity());
+
+        // the chunks are kept when the elements are removed
+        list4.clear();
+        ASSERT_EQUALS(0, list4.size());
+        ASSERT_EQUALS(28, list4.capacity());
+    }
+
+    void elements() const {
+        ChunkedList<std::string, 1> list;
+        std::vector<const std::string*> pointers;
+        for (int i = 0; i < 1000; ++i)
+            pointers.push_back(&list.emplace_back(std::to_string(i)));
+        ASSERT_EQUALS(1000, list.size());
+        ASSERT_EQUALS("0", list.front());
+        ASSERT_EQUALS("999", list.back());
+
+        // the elements are never moved
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_EQUALS(std::to_string(i), list[i]);
+            ASSERT(pointers[i] == &list[i]);
+        }
+    }
+
+    void iterators() const {
+        ChunkedList<int, 2> list;
+        list.push_back(0);
+        ChunkedList<int, 2>::const_iterator it = list.cbegin();
+
+        // the iterators stay valid when elements are added
+        for (int i = 1; i < 100; ++i)
+            list.push_back(i);
+        int expected = 0;
+        for (; it != list.cend(); ++it) {
+            ASSERT_EQUALS(expected, *it);
+            ++expected;
+        }
+        ASSERT_EQUALS(100, expected);
+
+        ChunkedList<int, 2>::iterator last = list.end();
+        --last;
+        ASSERT_EQUALS(99, *last);
+    }
+
+    void popBack() const {
+        ChunkedList<std::string, 1> list;
+        list.emplace_back("a");
+        list.emplace_back("b");
+        list.emplace_back("c");
+        list.pop_back();
+        ASSERT_EQUALS(2, list.size());
+        ASSERT_EQUALS("b", list.back());
+        list.emplace_back("d");
+        ASSERT_EQUALS(3, list.size());
+        ASSERT_EQUALS("d", list.back());
+        ASSERT_EQUALS(3, list.capacity());
+    }
+};
+
+REGISTER_TEST(TestChunkedList)
@@ -26,6 +26,7 @@
 #include "fixture.h"
 #include "helpers.h"
 #include "path.h"
+#include "perfcounters.h"
 #include "platform.h"
 #include "redirect.h"
 #include "settings.h"
@@ -337,6 +338,20 @@ private:
         TEST_CASE(showtimeNone);
         TEST_CASE(showtimeEmpty);
         TEST_CASE(showtimeInvalid);
+        TEST_CASE(showmemory);
+        TEST_CASE(showcounters);
+        TEST_CASE(reportSlowest);
+        TEST_CASE(reportSlowestInvalid);
+        TEST_CASE(reportSlowestNoBuildDir);
+        TEST_CASE(showcountersNoShowtime);
+        TEST_CASE(progressStreamFd);
+        TEST_CASE(progressStreamUnix);
+        TEST_CASE(progressStreamInvalidFd);
+        TEST_CASE(progressStreamInvalid);
+        TEST_CASE(trace);
+        TEST_CASE(traceEmpty);
+        TEST_CASE(limitsReport);
+        TEST_CASE(limitsReportEmpty);
         TEST_CASE(errorlist);
         TEST_CASE(errorlistWithCfg);
         TEST_CASE(errorlistExclusive);
@@ -2260,6 +2275,118 @@ private:
         ASSERT_EQUALS("cppcheck: error: unrecognized --showtime mode: 'top10'. Supported modes: file, file-total, summary, top5_file, top5_summary.\n", logger->str());
     }
 
+    void showmemory() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--showmemory", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT(settings->showmemory);
+    }
+
+    void showcounters() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--showtime=summary", "--showcounters", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        // the counters are disabled if they are not available on this system
+        const std::string err = PerfCounters::error();
+        if (err.empty()) {
+            ASSERT(settings->showcounters);
+            ASSERT_EQUALS("", logger->str());
+        } else {
+            ASSERT(!settings->showcounters);
+            ASSERT_EQUALS("cppcheck: '--showcounters' has no effect - " + err + ".\n", logger->str());
+        }
+    }
+
+    void reportSlowest() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--cppcheck-build-dir=.", "--report-slowest=5", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS(5, settings->reportSlowest);
+    }
+
+    void reportSlowestInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--cppcheck-build-dir=.", "--report-slowest=-1", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--report-slowest=' needs to be a positive integer.\n", logger->str());
+    }
+
+    void reportSlowestNoBuildDir() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--report-slowest=5", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: '--report-slowest' requires '--cppcheck-build-dir'.\n", logger->str());
+    }
+
+    void showcountersNoShowtime() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--showcounters", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT(!settings->showcounters);
+        ASSERT_EQUALS("cppcheck: '--showcounters' has no effect without '--showtime'.\n", logger->str());
+    }
+
+    void progressStreamFd() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--progress-stream=fd:3", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS("fd:3", settings->progressStream);
+    }
+
+    void progressStreamUnix() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--progress-stream=unix:/tmp/progress.sock", "file.cpp"};
+#ifdef _WIN32
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: '--progress-stream=unix:' is not supported on Windows.\n", logger->str());
+#else
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS("unix:/tmp/progress.sock", settings->progressStream);
+#endif
+    }
+
+    void progressStreamInvalidFd() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--progress-stream=fd:-1", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--progress-stream=fd:' is not a valid file descriptor.\n", logger->str());
+    }
+
+    void progressStreamInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--progress-stream=stdout", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--progress-stream' needs to be 'fd:<n>' or 'unix:<path>'.\n", logger->str());
+    }
+
+    void trace() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--trace=trace.json", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS("trace.json", settings->traceFile);
+    }
+
+    void traceEmpty() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--trace=", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: no file specified for the '--trace' option.\n", logger->str());
+    }
+
+    void limitsReport() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--limits-report=limits.xml", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS("limits.xml", settings->limitsReportFile);
+    }
+
+    void limitsReportEmpty() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--limits-report=", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: no file specified for the '--limits-report' option.\n", logger->str());
+    }
+
     void errorlist() {
         REDIRECT;
         const char * const argv[] = {"cppcheck", "--errorlist"};
@@ -27,6 +27,7 @@
 #include <list>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "xml.h"
 
@@ -80,6 +81,8 @@ private:
 
         TEST_CASE(isCriticalErrorId);
 
+        TEST_CASE(reportLimit);
+
         TEST_CASE(TestReportType);
     }
 
@@ -777,6 +780,27 @@ private:
         // It does not abort all the analysis of the file. Like "missingInclude" there can be false negatives.
         ASSERT_EQUALS(false, ErrorLogger::isCriticalErrorId("misra-config"));
     }
+
+    void reportLimit() const {
+        class MetricLogger : public ErrorLogger {
+        public:
+            void reportOut(const std::string & /*outmsg*/, Color /*c*/) override {}
+            void reportErr(const ErrorMessage & /*msg*/) override {}
+            void reportMetric(const std::string &metric) override {
+                metrics.push_back(metric);
+            }
+            std::vector<std::string> metrics;
+        };
+
+        MetricLogger logger;
+        logger.reportLimit("a&b.cpp", "f<int>", "templateMaxTime", 10, 3, 12000);
+        logger.reportLimit("a.cpp", "", "valueFlowMaxIfCount", 100, 150);
+        ASSERT_EQUALS(2, logger.metrics.size());
+        ASSERT_EQUALS("<limit fileName=\"a&amp;b.cpp\" function=\"f&lt;int&gt;\" id=\"templateMaxTime\" limit=\"10\" work=\"3\" time=\"12000\"/>", logger.metrics[0]);
+        ASSERT_EQUALS("<limit fileName=\"a.cpp\" id=\"valueFlowMaxIfCount\" limit=\"100\" work=\"150\"/>", logger.metrics[1]);
+        ASSERT(ErrorLogger::isLimitMetric(logger.metrics[0]));
+        ASSERT(!ErrorLogger::isLimitMetric("<metric fileName=\"a.cpp\"/>"));
+    }
 };
 
 REGISTER_TEST(TestErrorLogger)
@@ -168,6 +168,7 @@ private:
         TEST_CASE(nullpointerSmartPointer);
         TEST_CASE(nullpointerOutOfMemory);
         TEST_CASE(nullpointerOutOfResources);
+        TEST_CASE(nullpointerSummaryReturn);
         TEST_CASE(functioncall);
         TEST_CASE(functioncalllibrary); // use Library to parse function call
         TEST_CASE(functioncallDefaultArguments);
@@ -4331,6 +4332,66 @@ private:
             errout_str());
     }
 
+    void nullpointerSummaryReturn() {
+        Settings s = settings;
+        s.summaryReturnValue["find"] = {0, 1};
+
+        // function in other translation unit always returns NULL
+        check("int* find(int x);\n"
+              "void f() {\n"
+              "    int* p = find(1);\n"
+              "    *p = 0;\n"
+              "}\n", s);
+        ASSERT_EQUALS("[test.cpp:4:6]: (warning) Possible null pointer dereference: p [nullPointer]\n", errout_str());
+
+        // overload with a different number of arguments
+        check("int* find(int x, int y);\n"
+              "void f() {\n"
+              "    *find(1, 2) = 0;\n"
+              "}\n", s);
+        ASSERT_EQUALS("", errout_str());
+
+        // function is defined in this translation unit
+        check("int* find(int x) { static int i; return &i; }\n"
+              "void f() {\n"
+              "    int* p = find(1);\n"
+              "    *p = 0;\n"
+              "}\n", s);
+        ASSERT_EQUALS("", errout_str());
+
+        // qualified call of a different function with the same name
+        check("namespace ns { int* find(int x); }\n"
+              "void f() {\n"
+              "    *ns::find(1) = 0;\n"
+              "}\n", s);
+        ASSERT_EQUALS("", errout_str());
+
+        check("void f() {\n"
+              "    *ns::find(1) = 0;\n"
+              "}\n", s);
+        ASSERT_EQUALS("", errout_str());
+
+        // function pointer with the same name
+        check("void f(int* (*find)(int)) {\n"
+              "    *find(1) = 0;\n"
+              "}\n", s);
+        ASSERT_EQUALS("", errout_str());
+
+        // library function with the same name
+        s.summaryReturnValue["strchr"] = {0, 2};
+        check("void f(char* s) {\n"
+              "    *strchr(s, 'a') = 0;\n"
+              "}\n", s);
+        ASSERT_EQUALS("", errout_str());
+
+        // member function with the same name
+        check("struct S { int* find(int x); };\n"
+              "void f(S& s) {\n"
+              "    *s.find(1) = 0;\n"
+              "}\n", s);
+        ASSERT_EQUALS("", errout_str());
+    }
+
     void functioncalllibrary() {
         SimpleTokenizer tokenizer(settingsDefault,*this,false);
         const char code[] = "void f() { int a,b,c; x(a,b,c); }";
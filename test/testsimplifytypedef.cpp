@@ -231,6 +231,7 @@ private:
         TEST_CASE(simplifyTypedef158);
         TEST_CASE(simplifyTypedef159);
         TEST_CASE(simplifyTypedef160);
+        TEST_CASE(simplifyTypedef161);
 
         TEST_CASE(simplifyTypedefFunction1);
         TEST_CASE(simplifyTypedefFunction2); // ticket #1685
@@ -3842,6 +3843,18 @@ private:
         ASSERT_EQUALS(exp2, simplifyTypedefC(code2));
     }
 
+    void simplifyTypedef161() {
+        const char code[] = "void f() {\n"
+                            "    typedef struct { int x; } A;\n"
+                            "    typedef A B;\n"
+                            "    typedef int C, *D;\n"
+                            "    B b;\n"
+                            "    D d;\n"
+                            "}\n";
+        const char exp[] = "void f ( ) { struct A { int x ; } ; struct A b ; int * d ; }";
+        ASSERT_EQUALS(exp, tok(code));
+    }
+
     void simplifyTypedefFunction1() {
         {
             const char code[] = "typedef void (*my_func)();\n"
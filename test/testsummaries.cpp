@@ -33,6 +33,7 @@ private:
         TEST_CASE(createSummaries1);
         TEST_CASE(createSummariesGlobal);
         TEST_CASE(createSummariesNoreturn);
+        TEST_CASE(createSummariesReturn);
     }
 
 #define createSummaries(...) createSummaries_(__FILE__, __LINE__, __VA_ARGS__)
@@ -55,6 +56,16 @@ private:
     void createSummariesNoreturn() {
         ASSERT_EQUALS("foo call:[bar] noreturn:[bar]\n", createSummaries("void foo() { bar(); }"));
     }
+
+    void createSummariesReturn() {
+        ASSERT_EQUALS("foo return:[0] argc:[0]\n", createSummaries("int* foo() { return nullptr; }"));
+        ASSERT_EQUALS("foo return:[-1] argc:[1]\n", createSummaries("int foo(int x) { if (x) return -1; return -1; }"));
+        ASSERT_EQUALS("foo\n", createSummaries("int foo(int x) { if (x) return 1; return 0; }"));
+        ASSERT_EQUALS("foo\n", createSummaries("static int foo() { return 0; }"));
+        ASSERT_EQUALS("foo\n", createSummaries("struct S { int foo() { return 0; } };"));
+        ASSERT_EQUALS("foo\n", createSummaries("namespace ns { int* foo() { return nullptr; } }"));
+        ASSERT_EQUALS("foo\n", createSummaries("namespace { int* foo() { return nullptr; } }"));
+    }
 };
 
 REGISTER_TEST(TestSummaries)
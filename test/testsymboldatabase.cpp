@@ -5902,9 +5902,7 @@ private:
         ASSERT(db);
         ASSERT_EQUALS(9, db->scopeList.size());
         ASSERT_EQUALS(1, db->scopeList.front().varlist.size());
-        auto list = db->scopeList;
-        list.pop_front();
-        ASSERT_EQUALS(true, std::all_of(list.cbegin(), list.cend(), [](const Scope& scope) {
+        ASSERT_EQUALS(true, std::all_of(std::next(db->scopeList.cbegin()), db->scopeList.cend(), [](const Scope& scope) {
             return scope.varlist.empty();
         }));
     }
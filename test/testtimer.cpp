@@ -17,10 +17,17 @@
  */
 
 #include "fixture.h"
+#include "perfcounters.h"
 #include "redirect.h"
 #include "timer.h"
 
 #include <chrono>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
 
 class TestTimer : public TestFixture {
 public:
@@ -29,6 +36,15 @@ public:
 private:
     void run() override {
         TEST_CASE(result);
+        TEST_CASE(resultThreads);
+        TEST_CASE(resultAggregated);
+        TEST_CASE(resultThread);
+        TEST_CASE(phaseListener);
+        TEST_CASE(reset);
+        TEST_CASE(memory);
+        TEST_CASE(counters);
+        TEST_CASE(countersThreads);
+        TEST_CASE(timerName);
     }
 
     void result() {
@@ -45,15 +61,15 @@ private:
 
         auto it = results.find("call1");
         ASSERT(it != results.cend());
-        ASSERT_EQUALS(3, it->second.size());
-        ASSERT_EQUALS(1230, it->second[0].count());
-        ASSERT_EQUALS(1235, it->second[1].count());
-        ASSERT_EQUALS(1239, it->second[2].count());
+        ASSERT_EQUALS(3, it->second.count);
+        ASSERT_EQUALS(3704, std::chrono::duration_cast<std::chrono::milliseconds>(it->second.sum).count());
+        ASSERT_EQUALS(1230, std::chrono::duration_cast<std::chrono::milliseconds>(it->second.min).count());
+        ASSERT_EQUALS(1239, std::chrono::duration_cast<std::chrono::milliseconds>(it->second.max).count());
 
         it = results.find("call2");
         ASSERT(it != results.cend());
-        ASSERT_EQUALS(1, it->second.size());
-        ASSERT_EQUALS(1234, it->second[0].count());
+        ASSERT_EQUALS(1, it->second.count);
+        ASSERT_EQUALS(1234, std::chrono::duration_cast<std::chrono::milliseconds>(it->second.sum).count());
 
         t1.showResults();
         ASSERT_EQUALS("call1: 3.704s (avg. 1.23467s / min 1.23s / max 1.239s - 3 result(s))\n"
@@ -65,6 +81,249 @@ private:
         t1.showResults(1, false);
         ASSERT_EQUALS("call1: 3.704s\n", GET_REDIRECT_OUTPUT);
     }
+
+    void resultThreads() {
+        TimerResults t1;
+        const TimerResults::Id id = TimerResults::getId("call1");
+        ASSERT_EQUALS(id, TimerResults::getId("call1"));
+
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i <= 4; ++i) {
+            threads.emplace_back([&t1, id, i]() {
+                for (int j = 0; j < 1000; ++j) {
+                    t1.addResults(id, std::chrono::nanoseconds{i});
+                    t1.addResults("call2", std::chrono::nanoseconds{2});
+                }
+            });
+        }
+        for (std::thread& t : threads)
+            t.join();
+
+        const std::map<std::string, TimerStats> results = t1.getResults();
+        ASSERT_EQUALS(2, results.size());
+
+        const TimerStats& call1 = results.at("call1");
+        ASSERT_EQUALS(4000, call1.count);
+        ASSERT_EQUALS(10000, call1.sum.count());
+        ASSERT_EQUALS(1, call1.min.count());
+        ASSERT_EQUALS(4, call1.max.count());
+
+        const TimerStats& call2 = results.at("call2");
+        ASSERT_EQUALS(4000, call2.count);
+        ASSERT_EQUALS(8000, call2.sum.count());
+    }
+
+    void resultAggregated() {
+        TimerStats stats;
+        stats.add(std::chrono::nanoseconds{5});
+        stats.add(std::chrono::nanoseconds{3});
+
+        TimerResults t1;
+        t1.addResults("call1", std::chrono::nanoseconds{4});
+        t1.addResults("call1", stats);
+        t1.addResults("call2", TimerStats{});
+
+        const std::map<std::string, TimerStats> results = t1.getResults();
+        ASSERT_EQUALS(1, results.size());
+        const TimerStats& call1 = results.at("call1");
+        ASSERT_EQUALS(3, call1.count);
+        ASSERT_EQUALS(12, call1.sum.count());
+        ASSERT_EQUALS(3, call1.min.count());
+        ASSERT_EQUALS(5, call1.max.count());
+    }
+
+    void resultThread() {
+        TimerResults t1;
+        t1.addResults("call1", std::chrono::nanoseconds{4});
+        t1.addResults("call1", std::chrono::nanoseconds{6});
+        // aggregated results are not measured by the current thread
+        TimerStats stats;
+        stats.add(std::chrono::nanoseconds{1});
+        t1.addResults("call2", stats);
+
+        std::thread t([&t1]() {
+            t1.addResults("call3", std::chrono::nanoseconds{2});
+        });
+        t.join();
+
+        const std::map<std::string, std::chrono::nanoseconds> results = t1.getThreadResults();
+        ASSERT_EQUALS(1, results.size());
+        ASSERT_EQUALS(10, results.at("call1").count());
+    }
+
+    void phaseListener() {
+        TimerResults t1;
+        std::vector<std::string> phases;
+        {
+            // a measurement which was started before the listener was set is not reported
+            Timer outer("outer", &t1);
+            t1.setPhaseListener([&phases](const std::string& phase) {
+                phases.push_back(phase);
+            });
+            {
+                Timer t("phase1", &t1);
+                Timer::run("phase2", &t1, []() {});
+            }
+            Timer::run("phase3", &t1, []() {});
+        }
+        const std::vector<std::string> expected{"phase1", "phase2", "phase1", "", "phase3", ""};
+        ASSERT_EQUALS(expected.size(), phases.size());
+        for (std::size_t i = 0; i < expected.size() && i < phases.size(); ++i)
+            ASSERT_EQUALS(expected[i], phases[i]);
+    }
+
+    void reset() {
+        TimerResults t1;
+        t1.addResults("call1", std::chrono::nanoseconds{4});
+        TimerStats stats;
+        stats.add(std::chrono::nanoseconds{1});
+        t1.addResults("call2", stats);
+        t1.reset();
+        ASSERT_EQUALS(0, t1.getResults().size());
+
+        t1.addResults("call1", std::chrono::nanoseconds{2});
+        const std::map<std::string, TimerStats> results = t1.getResults();
+        ASSERT_EQUALS(1, results.size());
+        ASSERT_EQUALS(1, results.at("call1").count);
+        ASSERT_EQUALS(2, results.at("call1").min.count());
+    }
+
+    void memory() {
+        REDIRECT;
+
+        TimerResults t1;
+        ASSERT(!t1.measureMemory());
+        t1.setMemory(true);
+        ASSERT(t1.measureMemory());
+
+        t1.addMemory("call1", 4096);
+        t1.addMemory("call1", -2048);
+        t1.addMemory("call2", 8192);
+        t1.addObjects("Token", 10, 200);
+        t1.addObjects("Token", 20, 200);
+        t1.addObjects("Scope", 1, 1024);
+        t1.addPeakRss(std::numeric_limits<std::size_t>::max() / 2);
+
+        t1.showMemory();
+        ASSERT_EQUALS("call2: +8 KiB RSS (1 result(s))\n"
+                      "call1: +2 KiB RSS (2 result(s))\n"
+                      "Token: 30 object(s) (5 KiB)\n"
+                      "Scope: 1 object(s) (1 KiB)\n"
+                      "Peak RSS: " + std::to_string(std::numeric_limits<std::size_t>::max() / 2 / 1024) + " KiB\n", GET_REDIRECT_OUTPUT);
+
+        // the measurements have been reset
+        t1.showMemory();
+        ASSERT_EQUALS("Peak RSS: " + std::to_string(std::numeric_limits<std::size_t>::max() / 2 / 1024) + " KiB\n", GET_REDIRECT_OUTPUT);
+    }
+
+    void counters() {
+        REDIRECT;
+
+        TimerResults t1;
+        ASSERT(!t1.measureCounters());
+        t1.setCounters(true);
+        ASSERT(t1.measureCounters());
+
+        PerfCounters::Values c1;
+        c1.counts = {1000, 2500, 10, 20};
+        c1.valid = {true, true, true, true};
+        PerfCounters::Values c2;
+        c2.counts = {1000, 1500, 5, 0};
+        c2.valid = {true, true, true, false};
+
+        t1.addResults("call1", std::chrono::milliseconds{1500});
+        t1.addCounters("call1", c1);
+        t1.addResults("call1", std::chrono::milliseconds{500});
+        t1.addCounters("call1", c2);
+        t1.addResults("call2", std::chrono::milliseconds{1000});
+
+        const std::map<std::string, PerfCounters::Values> counters = t1.getCounters();
+        ASSERT_EQUALS(1, counters.size());
+        const PerfCounters::Values& call1 = counters.at("call1");
+        ASSERT_EQUALS(2000, call1.counts[PerfCounters::CYCLES]);
+        ASSERT_EQUALS(4000, call1.counts[PerfCounters::INSTRUCTIONS]);
+        ASSERT_EQUALS(15, call1.counts[PerfCounters::CACHE_MISSES]);
+        ASSERT_EQUALS(20, call1.counts[PerfCounters::BRANCH_MISSES]);
+
+        // the counters are only shown with the metrics
+        t1.showResults();
+        ASSERT_EQUALS("call1: 2s (avg. 1s / min 0.5s / max 1.5s - 2 result(s)) [cycles: 2000 / instructions: 4000 (IPC 2.00) / cache-misses: 15 / branch-misses: 20]\n"
+                      "call2: 1s (avg. 1s / min 1s / max 1s - 1 result(s))\n", GET_REDIRECT_OUTPUT);
+        t1.showResults(1, false);
+        ASSERT_EQUALS("call1: 2s\n", GET_REDIRECT_OUTPUT);
+
+        // a counter which is not available is omitted
+        TimerResults t2;
+        t2.addResults("call1", std::chrono::milliseconds{1000});
+        t2.addCounters("call1", c2);
+        t2.showResults();
+        ASSERT_EQUALS("call1: 1s (avg. 1s / min 1s / max 1s - 1 result(s)) [cycles: 1000 / instructions: 1500 (IPC 1.50) / cache-misses: 5]\n", GET_REDIRECT_OUTPUT);
+
+        t1.reset();
+        ASSERT_EQUALS(0, t1.getCounters().size());
+
+        const PerfCounters::Values diff = c1.since(c2);
+        ASSERT_EQUALS(0, diff.counts[PerfCounters::CYCLES]);
+        ASSERT_EQUALS(1000, diff.counts[PerfCounters::INSTRUCTIONS]);
+        ASSERT_EQUALS(5, diff.counts[PerfCounters::CACHE_MISSES]);
+        ASSERT(!diff.valid[PerfCounters::BRANCH_MISSES]);
+        ASSERT(PerfCounters::Values{}.empty());
+        ASSERT(!diff.empty());
+    }
+
+    void countersThreads() {
+        TimerResults t1;
+        const TimerResults::Id id = TimerResults::getId("call1");
+
+        PerfCounters::Values c;
+        c.counts = {10, 20, 1, 0};
+        c.valid = {true, true, true, false};
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&t1, id, &c]() {
+                for (int j = 0; j < 1000; ++j) {
+                    t1.addCounters(id, c);
+                    t1.addCounters("call2", c);
+                }
+            });
+        }
+        for (std::thread& t : threads)
+            t.join();
+
+        const std::map<std::string, PerfCounters::Values> counters = t1.getCounters();
+        ASSERT_EQUALS(2, counters.size());
+        for (const auto& entry : counters) {
+            ASSERT_EQUALS(40000, entry.second.counts[PerfCounters::CYCLES]);
+            ASSERT_EQUALS(80000, entry.second.counts[PerfCounters::INSTRUCTIONS]);
+            ASSERT_EQUALS(4000, entry.second.counts[PerfCounters::CACHE_MISSES]);
+            ASSERT(!entry.second.valid[PerfCounters::BRANCH_MISSES]);
+        }
+    }
+
+    void timerName() {
+        const TimerName name("call1");
+        ASSERT_EQUALS("call1", name.name());
+        ASSERT_EQUALS(TimerResults::getId("call1"), name.id());
+
+        TimerResults t1;
+        std::vector<std::string> phases;
+        t1.setPhaseListener([&phases](const std::string& phase) {
+            phases.push_back(phase);
+        });
+        {
+            const Timer t(name, &t1);
+        }
+        Timer::run(name, &t1, []() {});
+        Timer::run("call1", &t1, []() {});
+
+        const std::map<std::string, TimerStats> results = t1.getResults();
+        ASSERT_EQUALS(1, results.size());
+        ASSERT_EQUALS(3, results.at("call1").count);
+        ASSERT_EQUALS(6, phases.size());
+        ASSERT_EQUALS("call1", phases[0]);
+        ASSERT_EQUALS("", phases[1]);
+    }
 };
 
 REGISTER_TEST(TestTimer)
@@ -25,6 +25,7 @@
 #include "standards.h"
 #include "token.h"
 #include "tokenlist.h"
+#include "vfvalue.h"
 
 #include <stack>
 #include <string>
@@ -46,6 +47,8 @@ private:
         TEST_CASE(isKeyword);
         TEST_CASE(notokens);
         TEST_CASE(ast1);
+        TEST_CASE(valueCount);
+        TEST_CASE(tokenCount);
     }
 
     // inspired by #5895
@@ -187,6 +190,65 @@ private:
         }
         tokenlist.createAst(); // do not crash
     }
+
+    void valueCount() const {
+        TokenList tokenlist(settingsDefault, Standards::Language::CPP);
+        tokenlist.addtoken("x", 1, 1, false);
+        tokenlist.addtoken("y", 1, 2, false);
+        tokenlist.addtoken("z", 1, 3, false);
+        ASSERT_EQUALS(0, tokenlist.getValueCount());
+
+        Token* x = tokenlist.front();
+        Token* y = x->next();
+        ASSERT(x->addValue(ValueFlow::Value(1)));
+        ASSERT(x->addValue(ValueFlow::Value(2)));
+        ASSERT(!x->addValue(ValueFlow::Value(2)));
+        ASSERT(y->addValue(ValueFlow::Value(3)));
+        ASSERT(y->next()->addValue(ValueFlow::Value(4)));
+        ASSERT_EQUALS(4, tokenlist.getValueCount());
+
+        // a known value replaces the possible values
+        ValueFlow::Value known(5);
+        known.setKnown();
+        ASSERT(x->addValue(known));
+        ASSERT_EQUALS(3, tokenlist.getValueCount());
+
+        y->removeValues([](const ValueFlow::Value& v) {
+            return v.intvalue == 3;
+        });
+        ASSERT_EQUALS(2, tokenlist.getValueCount());
+
+        x->clearValueFlow();
+        ASSERT_EQUALS(1, tokenlist.getValueCount());
+
+        y->deleteNext();
+        ASSERT_EQUALS(0, tokenlist.getValueCount());
+    }
+
+    void tokenCount() {
+        TokenList tokenlist(settingsDefault, Standards::Language::CPP);
+        ASSERT_EQUALS(0, tokenlist.getTokenCount());
+        tokenlist.addtoken("x", 1, 1, false);
+        tokenlist.addtoken("y", 1, 2, false);
+        tokenlist.addtoken("z", 1, 3, false);
+        ASSERT_EQUALS(3, tokenlist.getTokenCount());
+
+        tokenlist.front()->insertToken("w");
+        ASSERT_EQUALS(4, tokenlist.getTokenCount());
+
+        tokenlist.front()->deleteNext(2);
+        ASSERT_EQUALS(2, tokenlist.getTokenCount());
+
+        tokenlist.front()->deleteThis();
+        ASSERT_EQUALS(1, tokenlist.getTokenCount());
+
+        SimpleTokenizer tokenizer(settingsDefault, *this);
+        ASSERT(tokenizer.tokenize("template<class T> T f(T t) { return t; } int x = f<int>(1); struct S { S(); };"));
+        std::size_t tokens = 0;
+        for (const Token* tok = tokenizer.tokens(); tok; tok = tok->next())
+            ++tokens;
+        ASSERT_EQUALS(tokens, tokenizer.list.getTokenCount());
+    }
 };
 
 REGISTER_TEST(TestTokenList)
@@ -168,6 +168,7 @@ private:
         TEST_CASE(valueFlowImpossibleMinMax);
         TEST_CASE(valueFlowImpossibleIncDec);
         TEST_CASE(valueFlowImpossibleUnknownConstant);
+        TEST_CASE(valueFlowImpossibleOverlap);
         TEST_CASE(valueFlowContainerEqual);
 
         mNewTemplate = false;
@@ -1829,6 +1830,27 @@ private:
         ASSERT_EQUALS("3,Assuming that condition 'x<50' is not redundant\n"
                       "3,Assuming that condition 'x<50' is not redundant\n",
                       getErrorPathForX(code, 4U));
+
+        // the return value of a function called with the same argument value has the path of each caller
+        code = "int f1(int a) { return a + 1; }\n"
+               "void f2() {\n"
+               "  int y = 3;\n"
+               "  int x = f1(y);\n"
+               "  a = x;\n"
+               "}\n"
+               "void f3() {\n"
+               "  int z = 3;\n"
+               "  int x = f1(z);\n"
+               "  a = x;\n"
+               "}\n";
+        ASSERT_EQUALS("3,Assignment 'y=3', assigned value is 3\n"
+                      "4,Calling function 'f1' returns 4\n"
+                      "4,Assignment 'x=f1(y)', assigned value is 4\n",
+                      getErrorPathForX(code, 5U));
+        ASSERT_EQUALS("8,Assignment 'z=3', assigned value is 3\n"
+                      "9,Calling function 'f1' returns 4\n"
+                      "9,Assignment 'x=f1(z)', assigned value is 4\n",
+                      getErrorPathForX(code, 10U));
     }
 
     void valueFlowBeforeCondition() {
@@ -5277,6 +5299,16 @@ private:
                "}\n";
         ASSERT_EQUALS(false, testValueOfX(code, 9U, 0));
         ASSERT_EQUALS(false, testValueOfX(code, 9U, 1));
+
+        // same function called several times with same and different arguments
+        code = "int f1(int a) {\n"
+               "  return a * 2;\n"
+               "}\n"
+               "int f2() {\n"
+               "    int x = f1(3) + f1(3) + f1(4);\n"
+               "    return x;\n"
+               "}";
+        ASSERT_EQUALS(true, testValueOfXKnown(code, 6U, 20));
     }
 
     void valueFlowFunctionDefaultParameter() {
@@ -9167,6 +9199,25 @@ private:
         ASSERT_EQUALS(true, testValueOfXImpossible(code, 4U, 0));
     }
 
+    void valueFlowImpossibleOverlap()
+    {
+        const char* code;
+
+        // "x <= 0" is implied by "x <= 2"
+        code = "int f(int x) {\n"
+               "    if (x <= 0) return 0;\n"
+               "    if (x <= 2) return 0;\n"
+               "    return x;\n"
+               "}\n";
+        std::list<ValueFlow::Value> values = tokenValues(code, "x ; }");
+        values.remove_if([](const ValueFlow::Value& v) {
+            return !v.isImpossible() || !v.isIntValue();
+        });
+        ASSERT_EQUALS(1, values.size());
+        ASSERT_EQUALS(2, values.front().intvalue);
+        ASSERT_EQUALS_ENUM(ValueFlow::Value::Bound::Upper, values.front().bound);
+    }
+
     void valueFlowContainerEqual()
     {
         const char* code;
@@ -0,0 +1,47 @@
+#!/usr/bin/env python
+from run_benchmarks import BENCHMARKS, compare_results, parse_showmemory, parse_showtime
+
+
+def test_parse_showtime():
+    output = ('Tokenizer::simplifyTokens1::ValueFlow: 1.5s (avg. 1.5s / min 1.5s / max 1.5s - 1 result(s))\n'
+              'valueFlowNumber(tokenlist, settings): 2.5e-05s (avg. 2.5e-05s / min 2.5e-05s / max 2.5e-05s - 1 result(s))\n'
+              'Checking file.c ...\n')
+    assert parse_showtime(output) == {
+        'Tokenizer::simplifyTokens1::ValueFlow': 1.5,
+        'valueFlowNumber(tokenlist, settings)': 2.5e-05
+    }
+
+
+def test_parse_showmemory():
+    # the token counts of each configuration are summed up and the last peak RSS is the overall one
+    output = ('Tokenizer::simplifyTokens1::ValueFlow: +524 KiB RSS (1 result(s))\n'
+              'Token: 100 object(s) (12 KiB)\n'
+              'Token: 50 object(s) (6 KiB)\n'
+              'Peak RSS: 1000 KiB\n'
+              'Peak RSS: 1200 KiB\n')
+    assert parse_showmemory(output) == (150, 1200)
+
+
+def __result(t, peak_rss):
+    return {'time': t, 'tokens': 0, 'peak_rss_kib': peak_rss, 'phases': {}}
+
+
+def test_compare_results():
+    old = {'benchmarks': {
+        'a': __result(1.0, 10000),
+        'b': __result(1.0, 10000),
+        'c': __result(0.01, 100),
+    }}
+    new = {'benchmarks': {
+        'a': __result(1.05, 10500),  # within the threshold
+        'b': __result(1.2, 12000),  # exceeds the threshold
+        'c': __result(0.03, 300),  # too small to compare
+        'd': __result(5.0, 50000),  # no baseline
+    }}
+    assert compare_results(old, new, 10.0) == [('b', 'time'), ('b', 'peak_rss_kib')]
+    assert compare_results(old, new, 25.0) == []
+
+
+def test_generators():
+    for _, gen, _ in BENCHMARKS.values():
+        assert gen()
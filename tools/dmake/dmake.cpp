@@ -495,6 +495,7 @@ int main(int argc, char **argv)
     }
     libfiles_h.emplace("analyzer.h");
     libfiles_h.emplace("calculate.h");
+    libfiles_h.emplace("chunkedlist.h");
     libfiles_h.emplace("config.h");
     libfiles_h.emplace("filesettings.h");
     libfiles_h.emplace("findtoken.h");
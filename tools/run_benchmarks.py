@@ -0,0 +1,340 @@
+#!/usr/bin/env python3
+
+# Run Cppcheck on a generated benchmark corpus and report the timings per phase, the
+# token count and the peak memory as JSON. The results of two builds can be compared
+# to catch performance regressions.
+#
+# Example usage:
+# python3 tools/run_benchmarks.py run --cppcheck=build/bin/cppcheck --output=new.json
+# python3 tools/run_benchmarks.py run --cppcheck=build/bin/cppcheck --output=new.json --baseline=old.json
+# python3 tools/run_benchmarks.py compare old.json new.json
+#
+# With CMake the "run-benchmarks" target runs the corpus with the built binary. Set
+# BENCHMARKS_BASELINE to a previous result to compare against it.
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+# Results are only compared if at least one of the measurements is above these limits
+# since short measurements are too flaky
+MIN_TIME = 0.05
+MIN_PEAK_RSS = 1024
+
+
+def gen_array_ints():
+    code = 'const int a[] = {\n'
+    code += ''.join('    {},\n'.format((i * 7919) % 10007) for i in range(20000))
+    code += '};\n'
+    return code
+
+
+def gen_array_floats():
+    code = 'const float f[] = {\n'
+    code += ''.join('    {}.{}f,\n'.format(i % 100, i % 7) for i in range(20000))
+    code += '};\n'
+    return code
+
+
+def gen_array_strings():
+    code = 'const char *strings[] = {\n'
+    code += ''.join('    "str{}",\n'.format(i) for i in range(20000))
+    code += '};\n'
+    return code
+
+
+def gen_templates():
+    code = '#include <cstddef>\n\n'
+    code += 'template<std::size_t N> struct Fib { static const std::size_t value = Fib<N - 1>::value + Fib<N - 2>::value; };\n'
+    code += 'template<> struct Fib<0> { static const std::size_t value = 0; };\n'
+    code += 'template<> struct Fib<1> { static const std::size_t value = 1; };\n\n'
+    code += 'template<class T, class U> struct Pair { T first; U second; };\n'
+    code += 'template<class... Ts> struct List {};\n'
+    code += 'template<class T> struct Wrap { T t; T get() const { return t; } };\n\n'
+    for i in range(200):
+        code += 'struct S{0} {{ int i; }};\n'.format(i)
+        code += 'template<class T> T f{0}(const Wrap<T>& w, const Pair<T, S{0}>& p) {{ return w.get() + p.first; }}\n'.format(i)
+    code += '\nint g()\n{\n    int sum = 0;\n'
+    for i in range(200):
+        code += '    sum += f{0}(Wrap<int>{{{0}}}, Pair<int, S{0}>{{{0}, S{0}{{}}}});\n'.format(i)
+        code += '    sum += f{0}(Wrap<long>{{{0}}}, Pair<long, S{0}>{{{0}, S{0}{{}}}});\n'.format(i)
+    code += '    List<' + ', '.join('S{}'.format(i) for i in range(200)) + '> l;\n'
+    code += '    (void)l;\n'
+    code += '    return sum + static_cast<int>(Fib<40>::value);\n}\n'
+    return code
+
+
+def gen_nesting():
+    depth = 40
+    code = 'int f(int x, int *p)\n{\n    int y = 0;\n'
+    for i in range(depth):
+        indent = '    ' * (i + 1)
+        code += indent + 'if (x > {}) {{\n'.format(i)
+        code += indent + '    y += x * {};\n'.format(i)
+        code += indent + '    for (int i{0} = 0; i{0} < x; ++i{0})\n'.format(i)
+        code += indent + '        y -= p[i{}];\n'.format(i)
+    for i in reversed(range(depth)):
+        code += '    ' * (i + 1) + '}\n'
+    code += '    return y;\n}\n'
+    return code
+
+
+def gen_switch():
+    code = 'int f(int x, int *p)\n{\n    int y = 0;\n    switch (x) {\n'
+    for i in range(3000):
+        code += '    case {}:\n'.format(i)
+        code += '        y = p[{}] + {};\n'.format(i % 16, i)
+        if i % 3 == 0:
+            code += '        if (y > x)\n            return y;\n'
+        code += '        break;\n'
+    code += '    default:\n        break;\n    }\n    return y;\n}\n'
+    return code
+
+
+def gen_configs():
+    count = 30
+    code = ''
+    for i in range(count):
+        code += '#ifdef CFG{}\n'.format(i)
+        code += 'static int f{0}(int x) {{ return x * {0}; }}\n'.format(i)
+        code += '#else\n'
+        code += 'static int f{0}(int x) {{ return x + {0}; }}\n'.format(i)
+        code += '#endif\n'
+    code += '\nint g(int x)\n{\n    int y = 0;\n'
+    for i in range(count):
+        code += '    y += f{}(x);\n'.format(i)
+    code += '    return y;\n}\n'
+    return code
+
+
+def gen_functions():
+    code = ''
+    for i in range(1000):
+        code += 'int f{0}(int x, int y)\n{{\n    if (x > y)\n        return x - {0};\n    return y + {0};\n}}\n'.format(i)
+    code += 'int g(int x)\n{\n    int y = 0;\n'
+    for i in range(1000):
+        code += '    y = f{}(x, y);\n'.format(i)
+    code += '    return y;\n}\n'
+    return code
+
+
+# name: (file name, generator, extra arguments)
+BENCHMARKS = {
+    'array-ints': ('array-ints.c', gen_array_ints, []),
+    'array-floats': ('array-floats.c', gen_array_floats, []),
+    'array-strings': ('array-strings.c', gen_array_strings, []),
+    'templates': ('templates.cpp', gen_templates, []),
+    'nesting': ('nesting.c', gen_nesting, []),
+    'switch': ('switch.c', gen_switch, []),
+    'configs': ('configs.c', gen_configs, ['--max-configs=31']),
+    'functions': ('functions.c', gen_functions, []),
+}
+
+
+def generate_corpus(path, names):
+    os.makedirs(path, exist_ok=True)
+    for name in names:
+        filename, gen, _ = BENCHMARKS[name]
+        with open(os.path.join(path, filename), 'wt') as f:
+            f.write(gen())
+
+
+def parse_showtime(output):
+    """parse the output of --showtime=summary"""
+    phases = {}
+    for line in output.splitlines():
+        res = re.match(r'^(.+): ([0-9.e+-]+)s \(avg\. ', line)
+        if res:
+            phases[res.group(1)] = float(res.group(2))
+    return phases
+
+
+def parse_showmemory(output):
+    """parse the token count and the overall peak RSS in KiB from the output of --showmemory"""
+    tokens = 0
+    peak_rss = 0
+    for line in output.splitlines():
+        res = re.match(r'^Token: ([0-9]+) object\(s\)', line)
+        if res:
+            tokens += int(res.group(1))
+            continue
+        res = re.match(r'^Peak RSS: ([0-9]+) KiB', line)
+        if res:
+            # the last one is the overall peak RSS
+            peak_rss = int(res.group(1))
+    return tokens, peak_rss
+
+
+def run_cppcheck(cppcheck, args):
+    cmd = [cppcheck, '-q'] + args
+    start = time.perf_counter()
+    p = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, check=False)
+    elapsed = time.perf_counter() - start
+    stdout = p.stdout.decode('utf-8', 'ignore')
+    if p.returncode != 0:
+        sys.stderr.write(p.stderr.decode('utf-8', 'ignore'))
+        raise RuntimeError('{} failed with exitcode {}'.format(' '.join(cmd), p.returncode))
+    return elapsed, stdout
+
+
+def run_benchmark(cppcheck, corpus, name, repeat):
+    filename, _, extra_args = BENCHMARKS[name]
+    args = extra_args + [os.path.join(corpus, filename)]
+
+    # the fastest run is the one which was least disturbed
+    best_time = None
+    phases = {}
+    for _ in range(repeat):
+        elapsed, stdout = run_cppcheck(cppcheck, ['--showtime=summary'] + args)
+        if best_time is None or elapsed < best_time:
+            best_time = elapsed
+            phases = parse_showtime(stdout)
+
+    # the memory is measured separately since it adds overhead to each timed phase
+    _, stdout = run_cppcheck(cppcheck, ['--showmemory'] + args)
+    tokens, peak_rss = parse_showmemory(stdout)
+
+    return {
+        'time': best_time,
+        'tokens': tokens,
+        'peak_rss_kib': peak_rss,
+        'phases': phases
+    }
+
+
+def get_version(cppcheck):
+    p = subprocess.run([cppcheck, '--version'], stdout=subprocess.PIPE, stderr=subprocess.PIPE, check=False)
+    return p.stdout.decode('utf-8', 'ignore').strip()
+
+
+def run(args):
+    names = args.benchmark or list(BENCHMARKS)
+    for name in names:
+        if name not in BENCHMARKS:
+            print('unknown benchmark: {}'.format(name))
+            return 1
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        corpus = args.corpus or tmpdir
+        generate_corpus(corpus, names)
+
+        results = {
+            'cppcheck': args.cppcheck,
+            'version': get_version(args.cppcheck),
+            'repeat': args.repeat,
+            'benchmarks': {}
+        }
+        for name in names:
+            print('running {}...'.format(name))
+            result = run_benchmark(args.cppcheck, corpus, name, args.repeat)
+            print('  time: {:.3f}s tokens: {} peak RSS: {} KiB'.format(result['time'], result['tokens'], result['peak_rss_kib']))
+            results['benchmarks'][name] = result
+
+    if args.output:
+        with open(args.output, 'wt') as f:
+            json.dump(results, f, indent=4, sort_keys=True)
+
+    if args.baseline:
+        with open(args.baseline, 'rt') as f:
+            baseline = json.load(f)
+        return 1 if print_comparison(baseline, results, args.threshold, args.phases) else 0
+    return 0
+
+
+def format_change(old, new):
+    if old == 0:
+        return 'N/A'
+    return '{:+.1f}%'.format((new - old) * 100.0 / old)
+
+
+def is_regression(old, new, threshold, min_value):
+    if max(old, new) < min_value:
+        return False
+    return new > old * (1.0 + threshold / 100.0)
+
+
+def compare_results(old, new, threshold):
+    """compare the results of two runs and return the benchmarks which regressed"""
+    regressions = []
+    for name, new_result in sorted(new['benchmarks'].items()):
+        old_result = old['benchmarks'].get(name)
+        if old_result is None:
+            continue
+        if is_regression(old_result['time'], new_result['time'], threshold, MIN_TIME):
+            regressions.append((name, 'time'))
+        if is_regression(old_result['peak_rss_kib'], new_result['peak_rss_kib'], threshold, MIN_PEAK_RSS):
+            regressions.append((name, 'peak_rss_kib'))
+    return regressions
+
+
+def print_comparison(old, new, threshold, max_phases):
+    print('{:<16} {:>10} {:>10} {:>8}   {:>10} {:>10} {:>8}   {:>10} {:>10}'.format(
+        'benchmark', 'old[s]', 'new[s]', 'change', 'old[KiB]', 'new[KiB]', 'change', 'old tokens', 'new tokens'))
+    for name, new_result in sorted(new['benchmarks'].items()):
+        old_result = old['benchmarks'].get(name)
+        if old_result is None:
+            print('{:<16} (no baseline)'.format(name))
+            continue
+        print('{:<16} {:>10.3f} {:>10.3f} {:>8}   {:>10} {:>10} {:>8}   {:>10} {:>10}'.format(
+            name,
+            old_result['time'], new_result['time'], format_change(old_result['time'], new_result['time']),
+            old_result['peak_rss_kib'], new_result['peak_rss_kib'], format_change(old_result['peak_rss_kib'], new_result['peak_rss_kib']),
+            old_result['tokens'], new_result['tokens']))
+
+        # show the phases with the biggest absolute change
+        changes = []
+        for phase, new_time in new_result['phases'].items():
+            old_time = old_result['phases'].get(phase, 0.0)
+            if max(old_time, new_time) >= MIN_TIME:
+                changes.append((new_time - old_time, phase, old_time, new_time))
+        changes.sort(key=lambda c: abs(c[0]), reverse=True)
+        for _, phase, old_time, new_time in changes[:max_phases]:
+            print('    {:<60} {:>10.3f} {:>10.3f} {:>8}'.format(phase[:60], old_time, new_time, format_change(old_time, new_time)))
+
+    regressions = compare_results(old, new, threshold)
+    for name, what in regressions:
+        print('regression: {} {} exceeds the threshold of {}%'.format(name, what, threshold))
+    return regressions
+
+
+def compare(args):
+    with open(args.old, 'rt') as f:
+        old = json.load(f)
+    with open(args.new, 'rt') as f:
+        new = json.load(f)
+    return 1 if print_comparison(old, new, args.threshold, args.phases) else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run the Cppcheck performance benchmarks')
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    run_parser = subparsers.add_parser('run', help='run the benchmarks')
+    run_parser.add_argument('--cppcheck', required=True, help='the cppcheck binary')
+    run_parser.add_argument('--output', help='write the results as JSON to this file')
+    run_parser.add_argument('--corpus', help='generate the corpus into this directory instead of a temporary one')
+    run_parser.add_argument('--repeat', type=int, default=3, help='number of timed runs per benchmark (default: 3)')
+    run_parser.add_argument('--benchmark', action='append', help='only run the given benchmark (can be specified multiple times)')
+    run_parser.add_argument('--baseline', help='compare the results with the results in this file')
+
+    compare_parser = subparsers.add_parser('compare', help='compare the results of two runs')
+    compare_parser.add_argument('old', help='the results of the baseline')
+    compare_parser.add_argument('new', help='the results to compare')
+
+    for p in (run_parser, compare_parser):
+        p.add_argument('--threshold', type=float, default=10.0, help='regression threshold in percent (default: 10)')
+        p.add_argument('--phases', type=int, default=5, help='number of changed phases to show per benchmark (default: 5)')
+
+    args = parser.parse_args()
+    if args.command == 'run':
+        return run(args)
+    return compare(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())